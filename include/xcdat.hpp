@@ -7,11 +7,22 @@
 #include "xcdat/bc_vector_16.hpp"
 #include "xcdat/bc_vector_7.hpp"
 #include "xcdat/bc_vector_8.hpp"
+#include "xcdat/dawg.hpp"
+#include "xcdat/encoded_trie.hpp"
+#include "xcdat/front_coded_trie.hpp"
+#include "xcdat/infix_trie.hpp"
 #include "xcdat/load_visitor.hpp"
+#include "xcdat/louds_trie.hpp"
 #include "xcdat/mmap_visitor.hpp"
+#include "xcdat/nested_tail_vector.hpp"
+#include "xcdat/range_filter.hpp"
+#include "xcdat/repair_tail_vector.hpp"
 #include "xcdat/save_visitor.hpp"
 #include "xcdat/size_visitor.hpp"
+#include "xcdat/suffix_trie.hpp"
 #include "xcdat/trie.hpp"
+#include "xcdat/typed_trie.hpp"
+#include "xcdat/utf8_code_table.hpp"
 
 namespace xcdat {
 
@@ -27,6 +38,187 @@ using trie_7_type = trie<bc_vector_7>;
 //! The trie type with pointer-based DACs using 15-bit integers (for the 1st layer)
 using trie_15_type = trie<bc_vector_15>;
 
+//! The trie type with standard DACs using 8-bit integers and the Re-Pair compressed TAIL
+using trie_8_repair_type = trie<bc_vector_8, repair_tail_vector>;
+
+//! The trie type with standard DACs using 16-bit integers and the Re-Pair compressed TAIL
+using trie_16_repair_type = trie<bc_vector_16, repair_tail_vector>;
+
+//! The trie type with pointer-based DACs using 7-bit integers and the Re-Pair compressed TAIL
+using trie_7_repair_type = trie<bc_vector_7, repair_tail_vector>;
+
+//! The trie type with pointer-based DACs using 15-bit integers and the Re-Pair compressed TAIL
+using trie_15_repair_type = trie<bc_vector_15, repair_tail_vector>;
+
+//! The trie type with standard DACs using 8-bit integers and the TAIL nested in two levels of tries
+using trie_8_nested_type = trie<bc_vector_8, nested_tail_vector<2>>;
+
+//! The trie type with standard DACs using 16-bit integers and the TAIL nested in two levels of tries
+using trie_16_nested_type = trie<bc_vector_16, nested_tail_vector<2>>;
+
+//! The trie type with pointer-based DACs using 7-bit integers and the TAIL nested in two levels of tries
+using trie_7_nested_type = trie<bc_vector_7, nested_tail_vector<2>>;
+
+//! The trie type with pointer-based DACs using 15-bit integers and the TAIL nested in two levels of tries
+using trie_15_nested_type = trie<bc_vector_15, nested_tail_vector<2>>;
+
+//! The trie type with standard DACs using 8-bit integers and transitions labeled with UTF-8 characters
+using trie_8_utf8_type = trie<bc_vector_8, tail_vector, utf8_code_table>;
+
+//! The trie type with standard DACs using 16-bit integers and transitions labeled with UTF-8 characters
+using trie_16_utf8_type = trie<bc_vector_16, tail_vector, utf8_code_table>;
+
+//! The trie type with pointer-based DACs using 7-bit integers and transitions labeled with UTF-8 characters
+using trie_7_utf8_type = trie<bc_vector_7, tail_vector, utf8_code_table>;
+
+//! The trie type with pointer-based DACs using 15-bit integers and transitions labeled with UTF-8 characters
+using trie_15_utf8_type = trie<bc_vector_15, tail_vector, utf8_code_table>;
+
+//! The trie type with standard DACs using 8-bit integers storing keywords encoded in the order-preserving way
+using trie_8_encoded_type = encoded_trie<trie_8_type>;
+
+//! The trie type with standard DACs using 16-bit integers storing keywords encoded in the order-preserving way
+using trie_16_encoded_type = encoded_trie<trie_16_type>;
+
+//! The trie type with pointer-based DACs using 7-bit integers storing keywords encoded in the order-preserving way
+using trie_7_encoded_type = encoded_trie<trie_7_type>;
+
+//! The trie type with pointer-based DACs using 15-bit integers storing keywords encoded in the order-preserving way
+using trie_15_encoded_type = encoded_trie<trie_15_type>;
+
+//! The trie type with standard DACs using 8-bit integers, supporting lookup but not decode
+using trie_8_lookup_type = trie<bc_vector_8, tail_vector, code_table, trie_capability::lookup>;
+
+//! The trie type with standard DACs using 16-bit integers, supporting lookup but not decode
+using trie_16_lookup_type = trie<bc_vector_16, tail_vector, code_table, trie_capability::lookup>;
+
+//! The trie type with pointer-based DACs using 7-bit integers, supporting lookup but not decode
+using trie_7_lookup_type = trie<bc_vector_7, tail_vector, code_table, trie_capability::lookup>;
+
+//! The trie type with pointer-based DACs using 15-bit integers, supporting lookup but not decode
+using trie_15_lookup_type = trie<bc_vector_15, tail_vector, code_table, trie_capability::lookup>;
+
+//! The trie type with standard DACs using 8-bit integers, supporting only membership queries
+using trie_8_set_type = trie<bc_vector_8, tail_vector, code_table, trie_capability::set>;
+
+//! The trie type with standard DACs using 16-bit integers, supporting only membership queries
+using trie_16_set_type = trie<bc_vector_16, tail_vector, code_table, trie_capability::set>;
+
+//! The trie type with pointer-based DACs using 7-bit integers, supporting only membership queries
+using trie_7_set_type = trie<bc_vector_7, tail_vector, code_table, trie_capability::set>;
+
+//! The trie type with pointer-based DACs using 15-bit integers, supporting only membership queries
+using trie_15_set_type = trie<bc_vector_15, tail_vector, code_table, trie_capability::set>;
+
+//! The trie type with standard DACs using 8-bit integers, storing the node positions of IDs for fast decode
+using trie_8_fast_decode_type = trie<bc_vector_8, tail_vector, code_table, trie_capability::fast_decode>;
+
+//! The trie type with standard DACs using 16-bit integers, storing the node positions of IDs for fast decode
+using trie_16_fast_decode_type = trie<bc_vector_16, tail_vector, code_table, trie_capability::fast_decode>;
+
+//! The trie type with pointer-based DACs using 7-bit integers, storing the node positions of IDs for fast decode
+using trie_7_fast_decode_type = trie<bc_vector_7, tail_vector, code_table, trie_capability::fast_decode>;
+
+//! The trie type with pointer-based DACs using 15-bit integers, storing the node positions of IDs for fast decode
+using trie_15_fast_decode_type = trie<bc_vector_15, tail_vector, code_table, trie_capability::fast_decode>;
+
+//! The trie type with standard DACs using 8-bit integers, supporting prefix counting
+using trie_8_counting_type = trie<bc_vector_8, tail_vector, code_table, trie_capability::counting>;
+
+//! The trie type with standard DACs using 16-bit integers, supporting prefix counting
+using trie_16_counting_type = trie<bc_vector_16, tail_vector, code_table, trie_capability::counting>;
+
+//! The trie type with pointer-based DACs using 7-bit integers, supporting prefix counting
+using trie_7_counting_type = trie<bc_vector_7, tail_vector, code_table, trie_capability::counting>;
+
+//! The trie type with pointer-based DACs using 15-bit integers, supporting prefix counting
+using trie_15_counting_type = trie<bc_vector_15, tail_vector, code_table, trie_capability::counting>;
+
+//! The trie type with standard DACs using 8-bit integers and a front-coded copy of keywords for fast decode
+using trie_8_fc_type = front_coded_trie<trie_8_lookup_type>;
+
+//! The trie type with standard DACs using 16-bit integers and a front-coded copy of keywords for fast decode
+using trie_16_fc_type = front_coded_trie<trie_16_lookup_type>;
+
+//! The trie type with pointer-based DACs using 7-bit integers and a front-coded copy of keywords for fast decode
+using trie_7_fc_type = front_coded_trie<trie_7_lookup_type>;
+
+//! The trie type with pointer-based DACs using 15-bit integers and a front-coded copy of keywords for fast decode
+using trie_15_fc_type = front_coded_trie<trie_15_lookup_type>;
+
+//! The trie type with standard DACs using 8-bit integers and a trie of reversed keywords for suffix search
+using trie_8_suffix_type = suffix_trie<trie_8_type, trie_8_lookup_type>;
+
+//! The trie type with standard DACs using 16-bit integers and a trie of reversed keywords for suffix search
+using trie_16_suffix_type = suffix_trie<trie_16_type, trie_16_lookup_type>;
+
+//! The trie type with pointer-based DACs using 7-bit integers and a trie of reversed keywords for suffix search
+using trie_7_suffix_type = suffix_trie<trie_7_type, trie_7_lookup_type>;
+
+//! The trie type with pointer-based DACs using 15-bit integers and a trie of reversed keywords for suffix search
+using trie_15_suffix_type = suffix_trie<trie_15_type, trie_15_lookup_type>;
+
+//! The trie type with standard DACs using 8-bit integers and a q-gram index for substring search
+using trie_8_infix_type = infix_trie<trie_8_type>;
+
+//! The trie type with standard DACs using 16-bit integers and a q-gram index for substring search
+using trie_16_infix_type = infix_trie<trie_16_type>;
+
+//! The trie type with pointer-based DACs using 7-bit integers and a q-gram index for substring search
+using trie_7_infix_type = infix_trie<trie_7_type>;
+
+//! The trie type with pointer-based DACs using 15-bit integers and a q-gram index for substring search
+using trie_15_infix_type = infix_trie<trie_15_type>;
+
+//! The trie type with standard DACs using 8-bit integers storing fixed-width keys such as integers
+template <class Key>
+using typed_trie_8_type = typed_trie<Key, trie_8_type>;
+
+//! The trie type with standard DACs using 16-bit integers storing fixed-width keys such as integers
+template <class Key>
+using typed_trie_16_type = typed_trie<Key, trie_16_type>;
+
+//! The trie type with pointer-based DACs using 7-bit integers storing fixed-width keys such as integers
+template <class Key>
+using typed_trie_7_type = typed_trie<Key, trie_7_type>;
+
+//! The trie type with pointer-based DACs using 15-bit integers storing fixed-width keys such as integers
+template <class Key>
+using typed_trie_15_type = typed_trie<Key, trie_15_type>;
+
+//! The minimal automaton type with standard DACs using 8-bit integers
+using dawg_8_type = dawg<bc_vector_8>;
+
+//! The minimal automaton type with standard DACs using 16-bit integers
+using dawg_16_type = dawg<bc_vector_16>;
+
+//! The minimal automaton type with pointer-based DACs using 7-bit integers (for the 1st layer)
+using dawg_7_type = dawg<bc_vector_7>;
+
+//! The minimal automaton type with pointer-based DACs using 15-bit integers (for the 1st layer)
+using dawg_15_type = dawg<bc_vector_15>;
+
+//! The LOUDS trie type with the plain TAIL
+using louds_trie_type = louds_trie<tail_vector>;
+
+//! The LOUDS trie type with the Re-Pair compressed TAIL
+using louds_trie_repair_type = louds_trie<repair_tail_vector>;
+
+//! The LOUDS trie type with the TAIL nested in two levels of tries
+using louds_trie_nested_type = louds_trie<nested_tail_vector<2>>;
+
+//! The approximate range filter type with standard DACs using 8-bit integers
+using range_filter_8_type = range_filter<bc_vector_8>;
+
+//! The approximate range filter type with standard DACs using 16-bit integers
+using range_filter_16_type = range_filter<bc_vector_16>;
+
+//! The approximate range filter type with pointer-based DACs using 7-bit integers (for the 1st layer)
+using range_filter_7_type = range_filter<bc_vector_7>;
+
+//! The approximate range filter type with pointer-based DACs using 15-bit integers (for the 1st layer)
+using range_filter_15_type = range_filter<bc_vector_15>;
+
 //! Set the continuous memory block to a new trie instance (for a memory-mapped file).
 template <class Trie>
 [[maybe_unused]] Trie mmap(const char* address) {
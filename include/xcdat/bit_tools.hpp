@@ -66,6 +66,17 @@ inline std::uint64_t msb(std::uint64_t x) {
 #endif
 }
 
+inline std::uint64_t lsb(std::uint64_t x) {
+#ifdef __SSE4_2__
+    return x == 0 ? 0 : __builtin_ctzll(x);
+#else
+    if (x == 0) {
+        return 0;
+    }
+    return bit_position(x & -x);
+#endif
+}
+
 inline std::uint64_t uleq_step_9(std::uint64_t x, std::uint64_t y) {
     return (((((y | msbs_step_9) - (x & ~msbs_step_9)) | (x ^ y)) ^ (x & ~y)) & msbs_step_9) >> 8;
 }
@@ -147,6 +147,23 @@ class bit_vector {
         return word_offset * 64 + bit_tools::select_in_word(m_bits[word_offset], n - curr_rank);
     }
 
+    // The smallest position of 1 in B[i..size), or size() if not found.
+    inline std::uint64_t successor(std::uint64_t i) const {
+        assert(i < size());
+
+        auto [wi, wj] = decompose<64>(i);
+        const std::uint64_t word = m_bits[wi] >> wj;
+        if (word != 0) {
+            return i + bit_tools::lsb(word);
+        }
+        for (wi += 1; wi < m_bits.size(); wi++) {
+            if (m_bits[wi] != 0) {
+                return wi * 64 + bit_tools::lsb(m_bits[wi]);
+            }
+        }
+        return size();
+    }
+
     template <class Visitor>
     void visit(Visitor& visitor) {
         visitor.visit(m_size);
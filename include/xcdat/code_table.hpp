@@ -7,7 +7,16 @@
 
 namespace xcdat {
 
+// A code table mapping each byte to a code, where a more frequent byte has a smaller code.
+// A transition of the double array consumes one byte.
 class code_table {
+  public:
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = 0;
+
+    //! The maximum number of bytes of a symbol (i.e., a transition label).
+    static constexpr std::uint64_t max_symbol_length = 1;
+
   private:
     std::uint64_t m_max_length = 0;
     std::array<std::uint8_t, 512> m_table;
@@ -80,8 +89,38 @@ class code_table {
         return static_cast<char>(m_table[cd + 256]);
     }
 
+    // Returns the code of the symbol at key[kpos] and advances kpos to the next symbol.
+    inline std::uint64_t get_code(std::string_view key, std::uint64_t& kpos) const {
+        return get_code(key[kpos++]);
+    }
+
+    // Returns the symbol of the code.
+    inline std::string_view get_symbol(std::uint64_t cd) const {
+        return std::string_view(reinterpret_cast<const char*>(&m_table[cd + 256]), 1);
+    }
+
+    // Returns the number of bytes of the symbol at key[kpos].
+    inline std::uint64_t symbol_length(std::string_view, std::uint64_t) const {
+        return 1;
+    }
+
+    // Checks if the symbol at key[kpos] is cut off by the end of key.
+    inline bool is_partial(std::string_view, std::uint64_t) const {
+        return false;
+    }
+
+    // Returns the code of the i-th smallest symbol in the alphabet.
+    inline std::uint64_t nth_code(std::uint64_t i) const {
+        return get_code(static_cast<char>(m_alphabet[i]));
+    }
+
+    // Returns the size of a double-array block, in which every code can be placed.
+    inline std::uint64_t block_size() const {
+        return 256;
+    }
+
     inline bool has_null() {
-        return *m_alphabet.begin() == '\0';
+        return alphabet_size() != 0 && m_alphabet[0] == '\0';
     }
 
     inline auto begin() const {
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+
+#include "bit_vector.hpp"
+#include "immutable_vector.hpp"
+
+namespace xcdat {
+
+// Directly addressable codes (DACs) storing integers in byte-wise layers, in the same manner as bc_vector_8.
+// An integer of smaller value occupies fewer layers, so this is compact for skewed distributions.
+class dac_vector {
+  public:
+    static constexpr std::uint32_t max_levels = sizeof(std::uint64_t);
+
+  private:
+    std::uint32_t m_num_levels = 0;
+    std::array<immutable_vector<std::uint8_t>, max_levels> m_bytes;
+    std::array<bit_vector, max_levels - 1> m_nexts;
+
+  public:
+    dac_vector() = default;
+    virtual ~dac_vector() = default;
+
+    dac_vector(const dac_vector&) = delete;
+    dac_vector& operator=(const dac_vector&) = delete;
+
+    dac_vector(dac_vector&&) noexcept = default;
+    dac_vector& operator=(dac_vector&&) noexcept = default;
+
+    template <class Vec>
+    explicit dac_vector(const Vec& vec) {
+        std::array<std::vector<std::uint8_t>, max_levels> bytes;
+        std::array<bit_vector::builder, max_levels> next_flags;  // The last will not be released
+
+        bytes[0].reserve(vec.size());
+        next_flags[0].reserve(vec.size());
+
+        m_num_levels = 0;
+
+        for (std::uint64_t i = 0; i < vec.size(); i++) {
+            std::uint64_t x = vec[i];
+            std::uint32_t j = 0;
+            bytes[j].push_back(static_cast<std::uint8_t>(x & 0xFFU));
+            next_flags[j].push_back(true);
+            x >>= 8;
+            while (x) {
+                ++j;
+                bytes[j].push_back(static_cast<std::uint8_t>(x & 0xFFU));
+                next_flags[j].push_back(true);
+                x >>= 8;
+            }
+            next_flags[j].set_bit(next_flags[j].size() - 1, false);
+            m_num_levels = std::max(m_num_levels, j);
+        }
+
+        // release
+        for (std::uint32_t i = 0; i < m_num_levels; ++i) {
+            m_bytes[i].build(bytes[i]);
+            m_nexts[i] = bit_vector(next_flags[i], true, false);
+        }
+        m_bytes[m_num_levels].build(bytes[m_num_levels]);
+    }
+
+    inline std::uint64_t operator[](std::uint64_t i) const {
+        std::uint32_t j = 0;
+        std::uint64_t x = m_bytes[j][i];
+        while (j < m_num_levels and m_nexts[j][i]) {
+            i = m_nexts[j++].rank(i);
+            x |= static_cast<std::uint64_t>(m_bytes[j][i]) << (j * 8);
+        }
+        return x;
+    }
+
+    inline std::uint64_t size() const {
+        return m_bytes[0].size();
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_num_levels);
+        for (std::uint32_t j = 0; j < m_bytes.size(); j++) {
+            visitor.visit(m_bytes[j]);
+        }
+        for (std::uint32_t j = 0; j < m_nexts.size(); j++) {
+            visitor.visit(m_nexts[j]);
+        }
+    }
+};
+
+}  // namespace xcdat
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "dac_vector.hpp"
+#include "dawg_builder.hpp"
+
+namespace xcdat {
+
+//! A compressed string dictionary based on a minimal acyclic automaton (or DAWG) in the double-array format.
+//! 'BcVector' is the data type of Base and Check vectors.
+//!
+//! Equivalent subtrees of the trie (e.g., shared suffixes such as inflections and file extensions) are merged
+//! into one state. A state is represented by its canonical unit, the first unit reaching it, and the other units
+//! reaching it are stored as leaves linking to the canonical unit. Since a state can have many parents, the ID of
+//! a keyword is not derived from the node position but counted along the path: each unit stores the number of
+//! keywords that precede its subtree among those of its parent. The IDs are therefore the ranks of the keywords
+//! in the lexicographical order. Decoding scans the children of each state in the order of symbols, so it is
+//! slower than that of the trie.
+template <class BcVector>
+class dawg {
+  public:
+    using dawg_type = dawg<BcVector>;
+    using bc_vector_type = BcVector;
+    using code_table_type = code_table;
+
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = (2U << 24) | bc_vector_type::l1_bits;
+
+  private:
+    bool m_bin_mode = false;
+    std::uint64_t m_num_keys = 0;
+    code_table_type m_table;
+    bit_vector m_terms;
+    bc_vector_type m_bcvec;
+    dac_vector m_offsets;
+
+  public:
+    //! Default constructor
+    dawg() = default;
+
+    //! Default destructor
+    virtual ~dawg() = default;
+
+    //! Copy constructor (deleted)
+    dawg(const dawg&) = delete;
+
+    //! Copy constructor (deleted)
+    dawg& operator=(const dawg&) = delete;
+
+    //! Move constructor
+    dawg(dawg&&) noexcept = default;
+
+    //! Move constructor
+    dawg& operator=(dawg&&) noexcept = default;
+
+    //! Build the automaton from the input keywords, which are lexicographically sorted and unique.
+    //! The arguments are the same as those of trie.
+    template <class Strings>
+    dawg(const Strings& keys, bool bin_mode = false)
+        : dawg(dawg_builder<Strings>(keys, bc_vector_type::l1_bits, bin_mode)) {
+        static_assert(sizeof(char) == sizeof(typename Strings::value_type::value_type));
+    }
+
+    //! Check if the binary mode.
+    inline bool bin_mode() const {
+        return m_bin_mode;
+    }
+
+    //! Get the number of stored keywords.
+    inline std::uint64_t num_keys() const {
+        return m_num_keys;
+    }
+
+    //! Get the alphabet size.
+    inline std::uint64_t alphabet_size() const {
+        return m_table.alphabet_size();
+    }
+
+    //! Get the maximum length of keywords.
+    inline std::uint64_t max_length() const {
+        return m_table.max_length();
+    }
+
+    //! Get the number of trie nodes (i.e., used DA units including the merged ones).
+    inline std::uint64_t num_nodes() const {
+        return m_bcvec.num_nodes();
+    }
+
+    //! Get the number of DA units.
+    inline std::uint64_t num_units() const {
+        return m_bcvec.num_units();
+    }
+
+    //! Get the number of unused DA units.
+    inline std::uint64_t num_free_units() const {
+        return m_bcvec.num_free_units();
+    }
+
+    //! Get the number of states of the automaton.
+    inline std::uint64_t num_states() const {
+        return num_nodes() - m_bcvec.num_leaves();
+    }
+
+    //! Get the length of TAIL vector (always zero since suffixes are merged in the automaton).
+    inline std::uint64_t tail_length() const {
+        return 0;
+    }
+
+    //! Lookup the ID of the keyword.
+    inline std::optional<std::uint64_t> lookup(std::string_view key) const {
+        std::uint64_t kpos = 0, npos = 0, id = 0;
+        while (kpos < key.size()) {
+            const std::uint64_t cpos = m_bcvec.base(npos) ^ m_table.get_code(key[kpos++]);
+            if (m_bcvec.check(cpos) != npos) {
+                return std::nullopt;
+            }
+            id += m_offsets[cpos];
+            npos = to_state(cpos);
+        }
+        if (!m_terms[npos]) {
+            return std::nullopt;
+        }
+        return id;
+    }
+
+    //! Decode the keyword associated with the ID.
+    inline std::string decode(std::uint64_t id) const {
+        std::string decoded;
+        decoded.reserve(max_length());
+        decode(id, decoded);
+        return decoded;
+    }
+
+    //! Decode the keyword associated with the ID and store it in 'decoded'.
+    //! It can avoid reallocation of memory to store the result.
+    inline void decode(std::uint64_t id, std::string& decoded) const {
+        decoded.clear();
+
+        if (num_keys() <= id) {
+            return;
+        }
+
+        std::uint64_t npos = 0;
+        while (!m_terms[npos] || id != 0) {
+            // Find the last child whose offset is not larger than id.
+            const std::uint64_t base = m_bcvec.base(npos);
+            std::uint64_t next_cpos = 0, next_code = 0;
+            for (std::uint64_t i = 0; i < m_table.alphabet_size(); i++) {
+                const std::uint64_t code = m_table.nth_code(i);
+                const std::uint64_t cpos = base ^ code;
+                if (m_bcvec.check(cpos) != npos) {
+                    continue;
+                }
+                if (id < m_offsets[cpos]) {
+                    break;
+                }
+                next_cpos = cpos;
+                next_code = code;
+            }
+            decoded.push_back(m_table.get_char(static_cast<std::uint8_t>(next_code)));
+            id -= m_offsets[next_cpos];
+            npos = to_state(next_cpos);
+        }
+    }
+
+    //! An iterator class for common prefix search.
+    //! It enumerates all the keywords contained as prefixes of a given string.
+    //! It should be instantiated via the function 'make_prefix_iterator'.
+    class prefix_iterator {
+      private:
+        const dawg_type* m_obj = nullptr;
+        std::string_view m_key;
+        std::uint64_t m_id = 0;
+        std::uint64_t m_kpos = 0;
+        std::uint64_t m_npos = 0;
+        bool is_beg = true;
+        bool is_end = false;
+
+      public:
+        prefix_iterator() = default;
+
+        //! Increment the iterator.
+        //! Return false if the iteration is terminated.
+        inline bool next() {
+            return m_obj != nullptr && m_obj->next_prefix(this);
+        }
+
+        //! Get the result ID.
+        inline std::uint64_t id() const {
+            return m_id;
+        }
+
+        //! Get the result keyword.
+        inline std::string decoded() const {
+            return std::string(m_key.data(), m_kpos);
+        }
+
+        //! Get the reference to the result keyword.
+        //! Note that the referenced data will be changed in the next iteration.
+        inline std::string_view decoded_view() const {
+            return std::string_view(m_key.data(), m_kpos);
+        }
+
+      private:
+        prefix_iterator(const dawg_type* obj, std::string_view key) : m_obj(obj), m_key(key) {}
+
+        friend class dawg;
+    };
+
+    //! Make the common prefix searcher for the given keyword.
+    inline prefix_iterator make_prefix_iterator(std::string_view key) const {
+        return prefix_iterator(this, key);
+    }
+
+    //! Preform common prefix search for the keyword.
+    inline void prefix_search(std::string_view key,
+                              const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_prefix_iterator(key);
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! An iterator class for predictive search.
+    //! It enumerates all the keywords starting with a given string.
+    //! It should be instantiated via the function 'make_predictive_iterator'.
+    class predictive_iterator {
+      public:
+        struct cursor_type {
+            std::uint64_t code;
+            std::uint64_t kpos;
+            std::uint64_t npos;
+            std::uint64_t id;  // the smallest ID in the subtree
+        };
+
+        //! The code of a cursor without a transition label.
+        static constexpr std::uint64_t no_code = UINT64_MAX;
+
+      private:
+        const dawg_type* m_obj = nullptr;
+        std::string_view m_key;
+        std::uint64_t m_id = 0;
+        std::string m_decoded;
+        std::vector<cursor_type> m_stack;
+        bool is_beg = true;
+        bool is_end = false;
+
+      public:
+        predictive_iterator() = default;
+
+        //! Increment the iterator.
+        //! Return false if the iteration is terminated.
+        inline bool next() {
+            return m_obj != nullptr && m_obj->next_predictive(this);
+        }
+
+        //! Get the result ID.
+        inline std::uint64_t id() const {
+            return m_id;
+        }
+
+        //! Get the result keyword.
+        inline std::string decoded() const {
+            return m_decoded;
+        }
+
+        //! Get the reference to the result keyword.
+        //! Note that the referenced data will be changed in the next iteration.
+        inline std::string_view decoded_view() const {
+            return m_decoded;
+        }
+
+      private:
+        predictive_iterator(const dawg_type* obj, std::string_view key) : m_obj(obj), m_key(key) {}
+
+        friend class dawg;
+    };
+
+    //! Make the predictive searcher for the keyword.
+    inline predictive_iterator make_predictive_iterator(std::string_view key) const {
+        return predictive_iterator(this, key);
+    }
+
+    //! Preform predictive search for the keyword.
+    inline void predictive_search(std::string_view key,
+                                  const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_predictive_iterator(key);
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! An iterator class for enumeration.
+    //! It enumerates all the keywords stored in the automaton.
+    //! It should be instantiated via the function 'make_enumerative_iterator'.
+    using enumerative_iterator = predictive_iterator;
+
+    //! Make the enumerator.
+    inline enumerative_iterator make_enumerative_iterator() const {
+        return enumerative_iterator(this, "");
+    }
+
+    //! Enumerate all the keywords and their IDs stored in the automaton.
+    inline void enumerate(const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_enumerative_iterator();
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! Visit the members (commonly used for I/O).
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_bin_mode);
+        visitor.visit(m_num_keys);
+        visitor.visit(m_table);
+        visitor.visit(m_terms);
+        visitor.visit(m_bcvec);
+        visitor.visit(m_offsets);
+    }
+
+  private:
+    template <class Strings>
+    explicit dawg(dawg_builder<Strings>&& b)
+        : m_bin_mode(b.m_bin_mode), m_num_keys(b.m_keys.size()), m_table(std::move(b.m_table)),
+          m_terms(b.m_terms, false, false), m_bcvec(b.m_units, std::move(b.m_leaves)), m_offsets(b.m_offsets) {}
+
+    // Returns the canonical unit of the state reached by the unit.
+    inline std::uint64_t to_state(std::uint64_t cpos) const {
+        return m_bcvec.is_leaf(cpos) ? m_bcvec.link(cpos) : cpos;
+    }
+
+    inline bool next_prefix(prefix_iterator* itr) const {
+        if (itr->is_end) {
+            return false;
+        }
+
+        if (itr->is_beg) {
+            itr->is_beg = false;
+            if (m_terms[itr->m_npos]) {
+                itr->m_id = 0;
+                return true;
+            }
+        }
+
+        while (itr->m_kpos < itr->m_key.size()) {
+            const std::uint64_t cpos = m_bcvec.base(itr->m_npos) ^ m_table.get_code(itr->m_key[itr->m_kpos++]);
+            if (m_bcvec.check(cpos) != itr->m_npos) {
+                break;
+            }
+            itr->m_id += m_offsets[cpos];
+            itr->m_npos = to_state(cpos);
+            if (m_terms[itr->m_npos]) {
+                return true;
+            }
+        }
+
+        itr->is_end = true;
+        itr->m_id = num_keys();
+        return false;
+    }
+
+    inline bool next_predictive(predictive_iterator* itr) const {
+        if (itr->is_end) {
+            return false;
+        }
+
+        if (itr->is_beg) {
+            itr->is_beg = false;
+
+            std::uint64_t kpos = 0, npos = 0, id = 0;
+            while (kpos < itr->m_key.size()) {
+                const std::uint64_t cpos = m_bcvec.base(npos) ^ m_table.get_code(itr->m_key[kpos++]);
+                if (m_bcvec.check(cpos) != npos) {
+                    itr->is_end = true;
+                    return false;
+                }
+                id += m_offsets[cpos];
+                npos = to_state(cpos);
+            }
+            itr->m_decoded = itr->m_key;
+            itr->m_stack.push_back({predictive_iterator::no_code, itr->m_key.size(), npos, id});
+        }
+
+        while (!itr->m_stack.empty()) {
+            const auto cur = itr->m_stack.back();
+            itr->m_stack.pop_back();
+
+            itr->m_decoded.resize(cur.kpos);
+            if (cur.code != predictive_iterator::no_code) {
+                itr->m_decoded.push_back(m_table.get_char(static_cast<std::uint8_t>(cur.code)));
+            }
+
+            // Push the children in the reverse order of symbols.
+            const std::uint64_t base = m_bcvec.base(cur.npos);
+            for (std::uint64_t i = m_table.alphabet_size(); i > 0; i--) {
+                const std::uint64_t code = m_table.nth_code(i - 1);
+                const std::uint64_t cpos = base ^ code;
+                if (m_bcvec.check(cpos) == cur.npos) {
+                    itr->m_stack.push_back({code, itr->m_decoded.size(), to_state(cpos), cur.id + m_offsets[cpos]});
+                }
+            }
+
+            if (m_terms[cur.npos]) {
+                itr->m_id = cur.id;
+                return true;
+            }
+        }
+
+        itr->is_end = true;
+        return false;
+    }
+};
+
+}  // namespace xcdat
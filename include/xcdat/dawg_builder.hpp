@@ -0,0 +1,366 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "bit_vector.hpp"
+#include "code_table.hpp"
+#include "exception.hpp"
+
+namespace xcdat {
+
+template <class Strings>
+class dawg_builder {
+    template <class>
+    friend class dawg;
+
+  public:
+    struct unit_type {
+        std::uint64_t base;
+        std::uint64_t check;
+    };
+
+    struct state_type {
+        bool is_final;
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> edges;  // (code, child) in the order of symbols
+    };
+
+  private:
+    static constexpr std::uint64_t taboo_npos = 1;
+    static constexpr std::uint64_t free_blocks = 16;
+    static constexpr std::uint64_t no_npos = UINT64_MAX;
+
+    const Strings& m_keys;
+    const std::uint32_t m_l1_bits;  // # of bits for L1 layer of DACs
+    const std::uint64_t m_l1_size;
+
+    bool m_bin_mode = false;
+
+    code_table m_table;
+    std::uint64_t m_block_size = 0;
+
+    // Minimal automaton
+    std::vector<state_type> m_states;
+    std::vector<std::uint64_t> m_counts;  // # of keywords accepted from each state
+    std::vector<std::uint64_t> m_unused_states;
+    std::unordered_map<std::string, std::uint64_t> m_register;
+    std::vector<std::uint64_t> m_path;  // states on the path of the last keyword
+    std::vector<std::uint64_t> m_canons;  // the canonical unit of each state
+
+    // Double array
+    std::vector<unit_type> m_units;
+    std::vector<std::uint64_t> m_offsets;
+    bit_vector::builder m_leaves;
+    bit_vector::builder m_terms;
+    bit_vector::builder m_useds;
+    std::vector<std::uint64_t> m_heads;  // for L1 blocks
+    std::vector<std::uint64_t> m_edges;
+
+  public:
+    explicit dawg_builder(const Strings& keys, std::uint32_t l1_bits, bool bin_mode)
+        : m_keys(keys), m_l1_bits(std::min(l1_bits, 8U)), m_l1_size(1ULL << m_l1_bits), m_bin_mode(bin_mode) {
+        XCDAT_THROW_IF(m_keys.size() == 0, "The input dataset is empty.");
+
+        // Build the code table
+        m_table = code_table(keys);
+        m_bin_mode |= m_table.has_null();
+        m_block_size = m_table.block_size();
+
+        // Build the minimal automaton
+        build_automaton();
+
+        // Reserve
+        {
+            std::uint64_t init_capa = 1;
+            while (init_capa < m_states.size()) {
+                init_capa <<= 1;
+            }
+            m_units.reserve(init_capa);
+            m_offsets.reserve(init_capa);
+            m_leaves.reserve(init_capa);
+            m_terms.reserve(init_capa);
+            m_useds.reserve(init_capa);
+            m_heads.reserve(init_capa >> m_l1_bits);
+            m_edges.reserve(256);
+        }
+
+        // Initialize an empty list.
+        for (std::uint64_t npos = 0; npos < m_block_size; ++npos) {
+            m_units.push_back(unit_type{npos + 1, npos - 1});
+            m_offsets.push_back(0);
+            m_leaves.push_back(false);
+            m_terms.push_back(false);
+            m_useds.push_back(false);
+        }
+        m_units[m_block_size - 1].base = 0;
+        m_units[0].check = m_block_size - 1;
+
+        for (std::uint64_t npos = 0; npos < m_block_size; npos += m_l1_size) {
+            m_heads.push_back(npos);
+        }
+
+        // Fix the root
+        use_unit(0);
+        m_units[0].check = taboo_npos;
+        m_useds.set_bit(taboo_npos, true);
+        m_heads[taboo_npos >> m_l1_bits] = m_units[taboo_npos].base;
+
+        // Build the BC units
+        m_canons.resize(m_states.size(), no_npos);
+        m_canons[0] = 0;
+        m_terms.set_bit(0, m_states[0].is_final);
+        arrange(0, 0);
+
+        // Finish
+        finish();
+    }
+
+    virtual ~dawg_builder() = default;
+
+    dawg_builder(const dawg_builder&) = delete;
+    dawg_builder& operator=(const dawg_builder&) = delete;
+
+    dawg_builder(dawg_builder&&) noexcept = default;
+    dawg_builder& operator=(dawg_builder&&) noexcept = default;
+
+  private:
+    // Builds the minimal acyclic automaton from the sorted keywords in the manner of Daciuk et al. [2000].
+    // The states on the path of the last keyword are not registered until the path diverges.
+    void build_automaton() {
+        m_states.push_back(state_type{false, {}});
+        m_counts.push_back(0);
+        m_path.push_back(0);
+
+        std::string_view prev;
+        for (std::uint64_t i = 0; i < m_keys.size(); i++) {
+            const std::string_view key{m_keys[i].data(), m_keys[i].size()};
+            if (i != 0) {
+                XCDAT_THROW_IF(key == prev, "The input keys are not unique.");
+                XCDAT_THROW_IF(key < prev, "The input keys are not in lexicographical order.");
+            }
+
+            std::uint64_t lcp = 0;
+            while (lcp < prev.size() && lcp < key.size() && prev[lcp] == key[lcp]) {
+                ++lcp;
+            }
+            minimize(lcp);
+
+            for (std::uint64_t kpos = lcp; kpos < key.size(); kpos++) {
+                const std::uint64_t child = make_state();
+                m_states[m_path.back()].edges.emplace_back(m_table.get_code(key[kpos]), child);
+                m_path.push_back(child);
+            }
+            m_states[m_path.back()].is_final = true;
+            prev = key;
+        }
+        minimize(0);
+
+        // The root is not registered.
+        m_counts[0] = count_keys(0);
+        m_register.clear();
+    }
+
+    // Registers the states on the path deeper than depth, replacing each with an equivalent state if exists.
+    void minimize(std::uint64_t depth) {
+        while (depth + 1 < m_path.size()) {
+            const std::uint64_t child = m_path.back();
+            m_path.pop_back();
+
+            const std::string sig = signature(child);
+            const auto it = m_register.find(sig);
+            if (it != m_register.end()) {
+                m_states[m_path.back()].edges.back().second = it->second;
+                m_unused_states.push_back(child);
+            } else {
+                m_counts[child] = count_keys(child);
+                m_register.emplace(sig, child);
+            }
+        }
+    }
+
+    inline std::uint64_t make_state() {
+        if (!m_unused_states.empty()) {
+            const std::uint64_t s = m_unused_states.back();
+            m_unused_states.pop_back();
+            m_states[s].is_final = false;
+            m_states[s].edges.clear();
+            return s;
+        }
+        m_states.push_back(state_type{false, {}});
+        m_counts.push_back(0);
+        return m_states.size() - 1;
+    }
+
+    inline std::uint64_t count_keys(std::uint64_t s) const {
+        std::uint64_t count = m_states[s].is_final ? 1 : 0;
+        for (const auto& [code, child] : m_states[s].edges) {
+            count += m_counts[child];
+        }
+        return count;
+    }
+
+    inline std::string signature(std::uint64_t s) const {
+        const auto& edges = m_states[s].edges;
+        std::string sig(1 + edges.size() * sizeof(edges[0]), '\0');
+        sig[0] = m_states[s].is_final ? 1 : 0;
+        if (!edges.empty()) {
+            std::memcpy(&sig[1], edges.data(), edges.size() * sizeof(edges[0]));
+        }
+        return sig;
+    }
+
+    inline void use_unit(std::uint64_t npos) {
+        m_useds.set_bit(npos);
+
+        const auto next = m_units[npos].base;
+        const auto prev = m_units[npos].check;
+        m_units[prev].base = next;
+        m_units[next].check = prev;
+
+        const auto lpos = npos >> m_l1_bits;
+        if (m_heads[lpos] == npos) {
+            m_heads[lpos] = (lpos != next >> m_l1_bits) ? taboo_npos : next;
+        }
+    }
+
+    inline void close_block(std::uint64_t bpos) {
+        const auto beg_npos = bpos * m_block_size;
+        const auto end_npos = beg_npos + m_block_size;
+
+        for (auto npos = beg_npos; npos < end_npos; ++npos) {
+            if (!m_useds[npos]) {
+                use_unit(npos);
+                m_useds.set_bit(npos, false);
+                m_units[npos].base = npos;
+                m_units[npos].check = npos;
+            }
+        }
+
+        for (auto npos = beg_npos; npos < end_npos; npos += m_l1_size) {
+            m_heads[npos >> m_l1_bits] = taboo_npos;
+        }
+    }
+
+    void expand() {
+        const auto old_size = static_cast<std::uint64_t>(m_units.size());
+        const auto new_size = old_size + m_block_size;
+
+        for (auto npos = old_size; npos < new_size; ++npos) {
+            m_units.push_back({npos + 1, npos - 1});
+            m_offsets.push_back(0);
+            m_leaves.push_back(false);
+            m_terms.push_back(false);
+            m_useds.push_back(false);
+        }
+
+        {
+            const auto last_npos = m_units[taboo_npos].check;
+            m_units[old_size].check = last_npos;
+            m_units[last_npos].base = old_size;
+            m_units[new_size - 1].base = taboo_npos;
+            m_units[taboo_npos].check = new_size - 1;
+        }
+
+        for (auto npos = old_size; npos < new_size; npos += m_l1_size) {
+            m_heads.push_back(npos);
+        }
+
+        const auto bpos = old_size / m_block_size;
+        if (free_blocks <= bpos) {
+            close_block(bpos - free_blocks);
+        }
+    }
+
+    void finish() {
+        while (m_units[taboo_npos].base != taboo_npos) {
+            auto bpos = m_units[taboo_npos].base / m_block_size;
+            close_block(bpos);
+        }
+    }
+
+    // Places the transitions of state s, whose canonical unit is npos.
+    // The first unit reaching a state becomes its canonical unit, and the other units reaching the state are
+    // marked as leaves whose links point to the canonical unit.
+    void arrange(std::uint64_t npos, std::uint64_t s) {
+        const auto& edges = m_states[s].edges;
+        if (edges.empty()) {
+            m_units[npos].base = 0;
+            return;
+        }
+
+        m_edges.clear();
+        for (const auto& [code, child] : edges) {
+            m_edges.push_back(code);
+        }
+
+        const auto base = xcheck(npos >> m_l1_bits);
+        if (m_units.size() <= base) {
+            expand();
+        }
+
+        // defining new edges
+        m_units[npos].base = base;
+        std::uint64_t offset = m_states[s].is_final ? 1 : 0;
+        for (const auto& [code, child] : edges) {
+            const auto cpos = base ^ code;
+            use_unit(cpos);
+            m_units[cpos].check = npos;
+            m_offsets[cpos] = offset;
+            offset += m_counts[child];
+
+            if (m_canons[child] == no_npos) {
+                m_canons[child] = cpos;
+                m_terms.set_bit(cpos, m_states[child].is_final);
+            } else {
+                m_units[cpos].base = m_canons[child];
+                m_leaves.set_bit(cpos, true);
+            }
+        }
+
+        // following the children
+        for (const auto& [code, child] : edges) {
+            const auto cpos = base ^ code;
+            if (m_canons[child] == cpos) {
+                arrange(cpos, child);
+            }
+        }
+    }
+
+    inline std::uint64_t xcheck(std::uint64_t lpos) const {
+        if (m_units[taboo_npos].base == taboo_npos) {  // Full?
+            return m_units.size() ^ m_edges[0];
+        }
+
+        // First, search in the same L1 block
+        for (auto i = m_heads[lpos]; i != taboo_npos && i >> m_l1_bits == lpos; i = m_units[i].base) {
+            const auto base = i ^ m_edges[0];
+            if (is_target(base)) {
+                return base;  // base / block_size_ == lpos
+            }
+        }
+
+        // Second, search in the other blocks
+        for (auto i = m_units[taboo_npos].base; i != taboo_npos; i = m_units[i].base) {
+            const auto base = i ^ m_edges[0];
+            if (is_target(base)) {
+                return base;  // base / block_size_ != lpos
+            }
+        }
+        return m_units.size() ^ m_edges[0];
+    }
+
+    inline bool is_target(std::uint64_t base) const {
+        for (const auto code : m_edges) {
+            if (m_useds[base ^ code]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+}  // namespace xcdat
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "key_encoder.hpp"
+
+namespace xcdat {
+
+//! A compressed string dictionary storing keywords encoded by an order-preserving key encoder.
+//! 'Trie' is the data type of the trie storing the encoded keywords.
+//!
+//! The encoder is trained on the input keywords at construction time and stored with the trie.
+//! Queries are encoded and results are decoded transparently, and the IDs are those of the underlying trie.
+//! Since the encoding keeps the lexicographical order, predictive search and enumeration report the
+//! keywords in the same order as the plain trie. Note that common prefix search is implemented by looking up
+//! every prefix of a query, because the encoding of a prefix is not always a prefix of the encoding.
+template <class Trie>
+class encoded_trie {
+  public:
+    using trie_type = Trie;
+    using bc_vector_type = typename trie_type::bc_vector_type;
+    using tail_vector_type = typename trie_type::tail_vector_type;
+    using code_table_type = typename trie_type::code_table_type;
+
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = (1U << 24) | trie_type::type_id;
+
+  private:
+    key_encoder m_encoder;
+    trie_type m_trie;
+
+  public:
+    //! Default constructor
+    encoded_trie() = default;
+
+    //! Default destructor
+    virtual ~encoded_trie() = default;
+
+    //! Copy constructor (deleted)
+    encoded_trie(const encoded_trie&) = delete;
+
+    //! Copy constructor (deleted)
+    encoded_trie& operator=(const encoded_trie&) = delete;
+
+    //! Move constructor
+    encoded_trie(encoded_trie&&) noexcept = default;
+
+    //! Move constructor
+    encoded_trie& operator=(encoded_trie&&) noexcept = default;
+
+    //! Build the trie from the input keywords, which are lexicographically sorted and unique.
+    //! The arguments are the same as those of the constructor of 'Trie'.
+    template <class Strings>
+    encoded_trie(const Strings& keys, bool bin_mode = false) : m_encoder(keys) {
+        std::vector<std::string> encoded_keys(keys.size());
+        for (std::uint64_t i = 0; i < keys.size(); i++) {
+            m_encoder.encode(std::string_view(keys[i].data(), keys[i].size()), encoded_keys[i]);
+        }
+        m_trie = trie_type(encoded_keys, bin_mode);
+    }
+
+    //! Check if the binary mode.
+    inline bool bin_mode() const {
+        return m_trie.bin_mode();
+    }
+
+    //! Get the number of stored keywords.
+    inline std::uint64_t num_keys() const {
+        return m_trie.num_keys();
+    }
+
+    //! Get the alphabet size (of the encoded keywords).
+    inline std::uint64_t alphabet_size() const {
+        return m_trie.alphabet_size();
+    }
+
+    //! Get the maximum length of keywords.
+    inline std::uint64_t max_length() const {
+        return m_encoder.max_length();
+    }
+
+    //! Get the number of trie nodes.
+    inline std::uint64_t num_nodes() const {
+        return m_trie.num_nodes();
+    }
+
+    //! Get the number of DA units.
+    inline std::uint64_t num_units() const {
+        return m_trie.num_units();
+    }
+
+    //! Get the number of unused DA units.
+    inline std::uint64_t num_free_units() const {
+        return m_trie.num_free_units();
+    }
+
+    //! Get the length of TAIL vector.
+    inline std::uint64_t tail_length() const {
+        return m_trie.tail_length();
+    }
+
+    //! Get the key encoder.
+    inline const key_encoder& encoder() const {
+        return m_encoder;
+    }
+
+    //! Lookup the ID of the keyword.
+    inline std::optional<std::uint64_t> lookup(std::string_view key) const {
+        std::string encoded;
+        m_encoder.encode(key, encoded);
+        return m_trie.lookup(encoded);
+    }
+
+    //! Decode the keyword associated with the ID.
+    inline std::string decode(std::uint64_t id) const {
+        std::string decoded;
+        decode(id, decoded);
+        return decoded;
+    }
+
+    //! Decode the keyword associated with the ID and store it in 'decoded'.
+    inline void decode(std::uint64_t id, std::string& decoded) const {
+        decoded.clear();
+        m_encoder.decode(m_trie.decode(id), decoded);
+    }
+
+    //! An iterator class for common prefix search.
+    //! It enumerates all the keywords contained as prefixes of a given string.
+    //! It should be instantiated via the function 'make_prefix_iterator'.
+    class prefix_iterator {
+      private:
+        const encoded_trie* m_obj = nullptr;
+        std::string_view m_key;
+        std::uint64_t m_id = 0;
+        std::uint64_t m_kpos = 0;
+        std::uint64_t m_next_kpos = 0;
+        std::string m_encoded;
+
+      public:
+        prefix_iterator() = default;
+
+        //! Increment the iterator.
+        //! Return false if the iteration is terminated.
+        inline bool next() {
+            while (m_obj != nullptr && m_next_kpos <= m_key.size()) {
+                m_kpos = m_next_kpos++;
+                m_obj->m_encoder.encode(m_key.substr(0, m_kpos), m_encoded);
+                if (const auto id = m_obj->m_trie.lookup(m_encoded); id.has_value()) {
+                    m_id = id.value();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //! Get the result ID.
+        inline std::uint64_t id() const {
+            return m_id;
+        }
+
+        //! Get the result keyword.
+        inline std::string decoded() const {
+            return std::string(m_key.data(), m_kpos);
+        }
+
+        //! Get the reference to the result keyword.
+        //! Note that the referenced data will be changed in the next iteration.
+        inline std::string_view decoded_view() const {
+            return std::string_view(m_key.data(), m_kpos);
+        }
+
+      private:
+        prefix_iterator(const encoded_trie* obj, std::string_view key) : m_obj(obj), m_key(key) {}
+
+        friend class encoded_trie;
+    };
+
+    //! Make the common prefix searcher for the given keyword.
+    inline prefix_iterator make_prefix_iterator(std::string_view key) const {
+        return prefix_iterator(this, key);
+    }
+
+    //! Preform common prefix search for the keyword.
+    inline void prefix_search(std::string_view key,
+                              const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_prefix_iterator(key);
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! An iterator class for predictive search.
+    //! It enumerates all the keywords starting with a given string.
+    //! It should be instantiated via the function 'make_predictive_iterator'.
+    //!
+    //! The keywords starting with a string p are those in [p, succ(p)), whose encodings are in
+    //! [encode(p), encode(succ(p))) and share the longest common prefix of the two bounds.
+    //! The iterator performs predictive search of the common prefix in the underlying trie and reports
+    //! the decoded keywords starting with p.
+    class predictive_iterator {
+      private:
+        const encoded_trie* m_obj = nullptr;
+        std::string_view m_key;
+        std::string m_prefix;  // the common prefix of the encoded bounds
+        typename trie_type::predictive_iterator m_itr;
+        std::string m_decoded;
+        bool is_beg = true;
+        bool is_end = false;
+
+      public:
+        predictive_iterator() = default;
+
+        //! Increment the iterator.
+        //! Return false if the iteration is terminated.
+        inline bool next() {
+            if (m_obj == nullptr || is_end) {
+                return false;
+            }
+            if (is_beg) {
+                // The underlying iterator refers to m_prefix, so it is made at the first increment.
+                m_itr = m_obj->m_trie.make_predictive_iterator(m_prefix);
+                is_beg = false;
+            }
+            while (m_itr.next()) {
+                m_decoded.clear();
+                m_obj->m_encoder.decode(m_itr.decoded_view(), m_decoded);
+
+                const auto cmp = std::string_view(m_decoded).substr(0, m_key.size()).compare(m_key);
+                if (cmp == 0) {
+                    return true;
+                }
+                if (0 < cmp) {
+                    break;  // The results are in the lexicographical order.
+                }
+            }
+            is_end = true;
+            return false;
+        }
+
+        //! Get the result ID.
+        inline std::uint64_t id() const {
+            return m_itr.id();
+        }
+
+        //! Get the result keyword.
+        inline std::string decoded() const {
+            return m_decoded;
+        }
+
+        //! Get the reference to the result keyword.
+        //! Note that the referenced data will be changed in the next iteration.
+        inline std::string_view decoded_view() const {
+            return m_decoded;
+        }
+
+      private:
+        predictive_iterator(const encoded_trie* obj, std::string_view key) : m_obj(obj), m_key(key) {
+            const auto succ = key_encoder::successor(key);
+            if (!succ.has_value()) {
+                return;  // All the strings not smaller than key are the targets.
+            }
+            std::string upper;
+            m_obj->m_encoder.encode(key, m_prefix);
+            m_obj->m_encoder.encode(succ.value(), upper);
+
+            std::uint64_t len = 0;
+            while (len < m_prefix.size() && len < upper.size() && m_prefix[len] == upper[len]) {
+                len += 1;
+            }
+            m_prefix.resize(len);
+        }
+
+        friend class encoded_trie;
+    };
+
+    //! Make the predictive searcher for the keyword.
+    inline predictive_iterator make_predictive_iterator(std::string_view key) const {
+        return predictive_iterator(this, key);
+    }
+
+    //! Preform predictive search for the keyword.
+    inline void predictive_search(std::string_view key,
+                                  const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_predictive_iterator(key);
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! An iterator class for enumeration.
+    //! It enumerates all the keywords stored in the trie.
+    //! It should be instantiated via the function 'make_enumerative_iterator'.
+    using enumerative_iterator = predictive_iterator;
+
+    //! Make the enumerator.
+    inline enumerative_iterator make_enumerative_iterator() const {
+        return enumerative_iterator(this, "");
+    }
+
+    //! Enumerate all the keywords and their IDs stored in the trie.
+    inline void enumerate(const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_enumerative_iterator();
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! Visit the members (commonly used for I/O).
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_encoder);
+        visitor.visit(m_trie);
+    }
+};
+
+}  // namespace xcdat
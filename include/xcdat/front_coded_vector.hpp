@@ -0,0 +1,122 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "compact_vector.hpp"
+#include "exception.hpp"
+#include "immutable_vector.hpp"
+
+namespace xcdat {
+
+// A string array compressed with bucketed front coding.
+//
+// The strings are split into buckets of 'bucket_size' consecutive strings. The first string of a bucket is
+// stored as it is, and each of the others is stored as the length of the longest common prefix with the
+// previous string and the remaining suffix. The lengths are encoded in variable bytes. The i-th string is
+// decoded by scanning its bucket from the head, so the access is sequential and within O(bucket_size) strings.
+class front_coded_vector {
+  public:
+    static constexpr std::uint64_t bucket_size = 16;
+
+  private:
+    std::uint64_t m_size = 0;
+    immutable_vector<char> m_bytes;
+    compact_vector m_heads;  // positions of the buckets in m_bytes
+
+  public:
+    front_coded_vector() = default;
+    virtual ~front_coded_vector() = default;
+
+    front_coded_vector(const front_coded_vector&) = delete;
+    front_coded_vector& operator=(const front_coded_vector&) = delete;
+
+    front_coded_vector(front_coded_vector&&) noexcept = default;
+    front_coded_vector& operator=(front_coded_vector&&) noexcept = default;
+
+    template <class Strings>
+    explicit front_coded_vector(const Strings& strs) : m_size(strs.size()) {
+        XCDAT_THROW_IF(strs.size() == 0, "The input dataset is empty.");
+
+        std::vector<char> bytes;
+        std::vector<std::uint64_t> heads;
+        std::string_view prev;
+
+        for (std::uint64_t i = 0; i < strs.size(); i++) {
+            const std::string_view curr(strs[i].data(), strs[i].size());
+            if (i % bucket_size == 0) {
+                heads.push_back(bytes.size());
+                put_vbyte(bytes, curr.size());
+                bytes.insert(bytes.end(), curr.begin(), curr.end());
+            } else {
+                std::uint64_t lcp = 0;
+                while (lcp < prev.size() && lcp < curr.size() && prev[lcp] == curr[lcp]) {
+                    lcp += 1;
+                }
+                put_vbyte(bytes, lcp);
+                put_vbyte(bytes, curr.size() - lcp);
+                bytes.insert(bytes.end(), curr.begin() + lcp, curr.end());
+            }
+            prev = curr;
+        }
+
+        m_bytes.build(bytes);
+        m_heads = compact_vector(heads);
+    }
+
+    //! Decode the i-th string and store it in 'decoded'.
+    inline void decode(std::uint64_t i, std::string& decoded) const {
+        assert(i < size());
+
+        const char* ptr = m_bytes.data() + m_heads[i / bucket_size];
+        const std::uint64_t len = get_vbyte(ptr);
+        decoded.assign(ptr, len);
+        ptr += len;
+
+        for (std::uint64_t j = i % bucket_size; j != 0; j--) {
+            const std::uint64_t lcp = get_vbyte(ptr);
+            const std::uint64_t rest = get_vbyte(ptr);
+            decoded.resize(lcp);
+            decoded.append(ptr, rest);
+            ptr += rest;
+        }
+    }
+
+    inline std::uint64_t size() const {
+        return m_size;
+    }
+
+    inline std::uint64_t num_bytes() const {
+        return m_bytes.size();
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_size);
+        visitor.visit(m_bytes);
+        visitor.visit(m_heads);
+    }
+
+  private:
+    static void put_vbyte(std::vector<char>& bytes, std::uint64_t x) {
+        while (128 <= x) {
+            bytes.push_back(static_cast<char>((x & 127) | 128));
+            x >>= 7;
+        }
+        bytes.push_back(static_cast<char>(x));
+    }
+
+    static inline std::uint64_t get_vbyte(const char*& ptr) {
+        std::uint64_t x = 0;
+        for (std::uint64_t shift = 0;; shift += 7) {
+            const auto c = static_cast<std::uint8_t>(*ptr++);
+            x |= static_cast<std::uint64_t>(c & 127) << shift;
+            if (c < 128) {
+                return x;
+            }
+        }
+    }
+};
+
+}  // namespace xcdat
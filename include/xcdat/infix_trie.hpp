@@ -0,0 +1,258 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "qgram_index.hpp"
+
+namespace xcdat {
+
+//! A compressed string dictionary with a q-gram inverted index for substring search.
+//! 'Trie' is the data type of the trie, which must support 'decode'.
+//!
+//! Each keyword ID is posted to the q-grams (substrings of q bytes) of the keyword. The keywords containing a
+//! pattern are found by intersecting the posting lists of the q-grams of the pattern and verifying the candidates
+//! with 'decode', so the time depends on the sizes of the posting lists instead of the number of keywords.
+template <class Trie>
+class infix_trie {
+  public:
+    using trie_type = Trie;
+    using bc_vector_type = typename trie_type::bc_vector_type;
+    using tail_vector_type = typename trie_type::tail_vector_type;
+    using code_table_type = typename trie_type::code_table_type;
+
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = (7U << 24) | trie_type::type_id;
+
+    //! The length of q-grams in bytes. The patterns shorter than q bytes are searched by scanning all the keywords.
+    static constexpr std::uint64_t q = qgram_index::q;
+
+  private:
+    trie_type m_trie;
+    qgram_index m_index;
+
+  public:
+    //! Default constructor
+    infix_trie() = default;
+
+    //! Default destructor
+    virtual ~infix_trie() = default;
+
+    //! Copy constructor (deleted)
+    infix_trie(const infix_trie&) = delete;
+
+    //! Copy constructor (deleted)
+    infix_trie& operator=(const infix_trie&) = delete;
+
+    //! Move constructor
+    infix_trie(infix_trie&&) noexcept = default;
+
+    //! Move constructor
+    infix_trie& operator=(infix_trie&&) noexcept = default;
+
+    //! Build the trie from the input keywords, which are lexicographically sorted and unique.
+    //! The arguments are the same as those of the constructor of 'Trie'.
+    template <class Strings>
+    infix_trie(const Strings& keys, bool bin_mode = false) : m_trie(keys, bin_mode) {
+        std::vector<std::uint64_t> ids(keys.size());
+        for (std::uint64_t i = 0; i < keys.size(); i++) {
+            ids[i] = m_trie.lookup(std::string_view(keys[i].data(), keys[i].size())).value();
+        }
+        m_index = qgram_index(keys, ids);
+    }
+
+    //! Check if the binary mode.
+    inline bool bin_mode() const {
+        return m_trie.bin_mode();
+    }
+
+    //! Get the number of stored keywords.
+    inline std::uint64_t num_keys() const {
+        return m_trie.num_keys();
+    }
+
+    //! Get the alphabet size.
+    inline std::uint64_t alphabet_size() const {
+        return m_trie.alphabet_size();
+    }
+
+    //! Get the maximum length of keywords.
+    inline std::uint64_t max_length() const {
+        return m_trie.max_length();
+    }
+
+    //! Get the number of trie nodes.
+    inline std::uint64_t num_nodes() const {
+        return m_trie.num_nodes();
+    }
+
+    //! Get the number of DA units.
+    inline std::uint64_t num_units() const {
+        return m_trie.num_units();
+    }
+
+    //! Get the number of unused DA units.
+    inline std::uint64_t num_free_units() const {
+        return m_trie.num_free_units();
+    }
+
+    //! Get the length of TAIL vector.
+    inline std::uint64_t tail_length() const {
+        return m_trie.tail_length();
+    }
+
+    //! Get the underlying trie.
+    inline const trie_type& underlying_trie() const {
+        return m_trie;
+    }
+
+    //! Get the number of distinct q-grams.
+    inline std::uint64_t num_grams() const {
+        return m_index.num_grams();
+    }
+
+    //! Get the number of bytes of the posting lists.
+    inline std::uint64_t posting_bytes() const {
+        return m_index.num_bytes();
+    }
+
+    //! Lookup the ID of the keyword.
+    inline std::optional<std::uint64_t> lookup(std::string_view key) const {
+        return m_trie.lookup(key);
+    }
+
+    //! Decode the keyword associated with the ID.
+    inline std::string decode(std::uint64_t id) const {
+        return m_trie.decode(id);
+    }
+
+    //! Decode the keyword associated with the ID and store it in 'decoded'.
+    //! It can avoid reallocation of memory to store the result.
+    inline void decode(std::uint64_t id, std::string& decoded) const {
+        m_trie.decode(id, decoded);
+    }
+
+    //! An iterator class for common prefix search (see trie::prefix_iterator).
+    using prefix_iterator = typename trie_type::prefix_iterator;
+
+    //! Make the common prefix searcher for the given keyword.
+    inline prefix_iterator make_prefix_iterator(std::string_view key) const {
+        return m_trie.make_prefix_iterator(key);
+    }
+
+    //! Preform common prefix search for the keyword.
+    inline void prefix_search(std::string_view key,
+                              const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        m_trie.prefix_search(key, fn);
+    }
+
+    //! An iterator class for predictive search (see trie::predictive_iterator).
+    using predictive_iterator = typename trie_type::predictive_iterator;
+
+    //! Make the predictive searcher for the keyword.
+    inline predictive_iterator make_predictive_iterator(std::string_view key) const {
+        return m_trie.make_predictive_iterator(key);
+    }
+
+    //! Make the predictive searcher resuming from the token of a searcher for the same keyword.
+    inline predictive_iterator make_predictive_iterator(std::string_view key, std::string_view token) const {
+        return m_trie.make_predictive_iterator(key, token);
+    }
+
+    //! Make the predictive searcher emitting only the IDs of the results.
+    inline predictive_iterator make_predictive_id_iterator(std::string_view key) const {
+        return m_trie.make_predictive_id_iterator(key);
+    }
+
+    //! Preform predictive search for the keyword.
+    inline void predictive_search(std::string_view key,
+                                  const std::function<void(std::uint64_t, std::string_view)>& fn,
+                                  std::uint64_t limit = UINT64_MAX) const {
+        m_trie.predictive_search(key, fn, limit);
+    }
+
+    //! Preform predictive search for the keyword, reporting only the IDs of the results.
+    inline void predictive_search_ids(std::string_view key, const std::function<void(std::uint64_t)>& fn,
+                                      std::uint64_t limit = UINT64_MAX) const {
+        m_trie.predictive_search_ids(key, fn, limit);
+    }
+
+    //! Preform substring search for the pattern, i.e., enumerate the keywords containing the given string.
+    //! The results are in the increasing order of their IDs.
+    //! The search is terminated after 'limit' results.
+    inline void infix_search(std::string_view pattern, const std::function<void(std::uint64_t, std::string_view)>& fn,
+                             std::uint64_t limit = UINT64_MAX) const {
+        std::string decoded;
+        decoded.reserve(max_length());
+
+        std::uint64_t num_results = 0;
+        auto verify = [&](std::uint64_t id) {
+            m_trie.decode(id, decoded);
+            if (decoded.find(pattern) != std::string::npos) {
+                fn(id, decoded);
+                num_results += 1;
+            }
+        };
+
+        if (pattern.size() < q) {
+            for (std::uint64_t id = 0; id < num_keys() && num_results < limit; id++) {
+                verify(id);
+            }
+            return;
+        }
+        for (const std::uint64_t id : m_index.candidates(pattern)) {
+            if (limit <= num_results) {
+                break;
+            }
+            verify(id);
+        }
+    }
+
+    //! An iterator class for enumeration (see trie::enumerative_iterator).
+    using enumerative_iterator = typename trie_type::enumerative_iterator;
+
+    //! Make the enumerator.
+    inline enumerative_iterator make_enumerative_iterator() const {
+        return m_trie.make_enumerative_iterator();
+    }
+
+    //! Make the enumerator resuming from the token of an enumerator.
+    inline enumerative_iterator make_enumerative_iterator(std::string_view token) const {
+        return m_trie.make_enumerative_iterator(token);
+    }
+
+    //! Make the enumerator emitting only the IDs of the keywords.
+    inline enumerative_iterator make_enumerative_id_iterator() const {
+        return m_trie.make_enumerative_id_iterator();
+    }
+
+    //! Enumerate all the keywords and their IDs stored in the trie.
+    inline void enumerate(const std::function<void(std::uint64_t, std::string_view)>& fn,
+                          std::uint64_t limit = UINT64_MAX) const {
+        m_trie.enumerate(fn, limit);
+    }
+
+    //! Enumerate the IDs of all the keywords stored in the trie.
+    inline void enumerate_ids(const std::function<void(std::uint64_t)>& fn, std::uint64_t limit = UINT64_MAX) const {
+        m_trie.enumerate_ids(fn, limit);
+    }
+
+    //! Enumerate the keywords starting with the given string with worker threads (see trie::parallel_enumerate).
+    inline void parallel_enumerate(std::string_view key, std::uint64_t num_threads,
+                                   const std::function<void(std::uint64_t, std::string_view)>& sink,
+                                   bool ordered = true) const {
+        m_trie.parallel_enumerate(key, num_threads, sink, ordered);
+    }
+
+    //! Visit the members (commonly used for I/O).
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_trie);
+        visitor.visit(m_index);
+    }
+};
+
+}  // namespace xcdat
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Encoding of the link value stored in the base field of a leaf unit.
+//
+// The lowest bit is a flag. If it is zero, the remaining bits indicate the position in the TAIL vector
+// (i.e., tpos = link >> 1, and link = 0 indicates the empty suffix). If it is one, a short suffix of
+// at most max_length bytes is stored in the link value itself as follows:
+//  - bits [1,3) store the suffix length, and
+//  - bits [3,3+8*length) store the suffix bytes in order from the lowest.
+// Such a suffix can be matched without accessing the TAIL vector.
+namespace xcdat::inline_tail {
+
+static constexpr std::uint64_t max_length = 3;
+
+inline bool is_inline(std::uint64_t link) {
+    return (link & 1ULL) != 0;
+}
+
+inline std::uint64_t to_link(std::uint64_t tpos) {
+    return tpos << 1;
+}
+
+inline std::uint64_t to_tpos(std::uint64_t link) {
+    return link >> 1;
+}
+
+inline std::uint64_t length(std::uint64_t link) {
+    return (link >> 1) & 3ULL;
+}
+
+inline char get(std::uint64_t link, std::uint64_t i) {
+    return static_cast<char>((link >> (3 + i * 8)) & 0xFFULL);
+}
+
+inline std::uint64_t encode(std::string_view str) {
+    std::uint64_t link = 1ULL | (str.size() << 1);
+    for (std::uint64_t i = 0; i < str.size(); i++) {
+        link |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(str[i])) << (3 + i * 8);
+    }
+    return link;
+}
+
+inline bool match(std::string_view key, std::uint64_t link) {
+    const std::uint64_t len = length(link);
+    if (key.size() != len) {
+        return false;
+    }
+    for (std::uint64_t i = 0; i < len; i++) {
+        if (key[i] != get(link, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the suffix length if the suffix is a prefix of key.
+inline std::optional<std::uint64_t> prefix_match(std::string_view key, std::uint64_t link) {
+    const std::uint64_t len = length(link);
+    if (key.size() < len) {
+        return std::nullopt;
+    }
+    for (std::uint64_t i = 0; i < len; i++) {
+        if (key[i] != get(link, i)) {
+            return std::nullopt;
+        }
+    }
+    return len;
+}
+
+// Checks if key is a prefix of the suffix.
+inline bool predictive_match(std::string_view key, std::uint64_t link) {
+    const std::uint64_t len = length(link);
+    if (len < key.size()) {
+        return false;
+    }
+    for (std::uint64_t i = 0; i < key.size(); i++) {
+        if (key[i] != get(link, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void decode(std::uint64_t link, std::string& decoded) {
+    const std::uint64_t len = length(link);
+    for (std::uint64_t i = 0; i < len; i++) {
+        decoded.push_back(get(link, i));
+    }
+}
+
+// Calls fn(c) for each character c of the suffix in reverse order until fn returns false.
+// Returns true if all the characters are scanned.
+template <class Fn>
+inline bool reverse_scan(std::uint64_t link, Fn&& fn) {
+    for (std::uint64_t i = length(link); i != 0; i--) {
+        if (!fn(get(link, i - 1))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace xcdat::inline_tail
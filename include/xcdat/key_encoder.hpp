@@ -0,0 +1,299 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "exception.hpp"
+#include "immutable_vector.hpp"
+
+namespace xcdat {
+
+// An order-preserving dictionary encoder of keywords, in the manner of HOPE [Zhang+, SIGMOD 2020].
+//
+// The space of strings is partitioned into at most 256 intervals by sorted boundary strings, and each interval
+// is assigned a one-byte code equal to its rank. A keyword is encoded from the head by repeatedly finding the
+// interval containing the rest and emitting its code. A symbol interval consumes its symbol, i.e., the common
+// prefix of all the strings in the interval. An escape interval, which only contains strings starting with a
+// byte not used in the training keywords, consumes one byte and emits it raw after the code. Since the codes
+// follow the order of the intervals, the encoding keeps the lexicographical order of keywords.
+//
+// The boundaries are the bytes c used in the keywords, c + 1, and frequent substrings g (grams) of a sample of
+// the keywords and their successors, so a frequent substring is encoded in one byte.
+class key_encoder {
+  public:
+    //! The maximum number of intervals (i.e., codes).
+    static constexpr std::uint64_t max_intervals = 256;
+
+    //! The maximum length of a gram.
+    static constexpr std::uint64_t max_gram_length = 12;
+
+    //! The maximum number of bytes of the keywords sampled to select grams.
+    static constexpr std::uint64_t max_sample_bytes = 1ULL << 16;
+
+  private:
+    std::uint64_t m_max_length = 0;
+    std::array<std::uint8_t, 256> m_firsts;  // the interval containing each single byte c
+    std::array<std::uint8_t, 256> m_lasts;  // the last interval whose lower bound starts with a byte <= c
+    immutable_vector<char> m_bounds;
+    immutable_vector<std::uint64_t> m_chunks;  // of the bounds for fast comparison (see get_chunk)
+    immutable_vector<std::uint32_t> m_offsets;  // of m_bounds for each interval
+    immutable_vector<std::uint8_t> m_lengths;  // of the symbols (0 for escape intervals)
+
+  public:
+    key_encoder() = default;
+    virtual ~key_encoder() = default;
+
+    key_encoder(const key_encoder&) = delete;
+    key_encoder& operator=(const key_encoder&) = delete;
+
+    key_encoder(key_encoder&&) noexcept = default;
+    key_encoder& operator=(key_encoder&&) noexcept = default;
+
+    template <class Strings>
+    explicit key_encoder(const Strings& keys) {
+        std::array<bool, 256> used = {};
+        m_max_length = 0;
+        for (const auto& key : keys) {
+            for (const char c : key) {
+                used[static_cast<std::uint8_t>(c)] = true;
+            }
+            m_max_length = std::max<std::uint64_t>(m_max_length, key.size());
+        }
+
+        std::vector<std::string> bounds = {std::string(1, '\0')};
+        for (std::uint64_t c = 0; c < 256; c++) {
+            if (used[c]) {
+                bounds.push_back(std::string(1, static_cast<char>(c)));
+                if (c != 255) {
+                    bounds.push_back(std::string(1, static_cast<char>(c + 1)));
+                }
+            }
+        }
+        normalize(bounds);
+
+        // Add the grams with larger gains while the intervals are not exhausted.
+        std::vector<std::string> grams;
+        for (const auto& gram : select_candidates(keys)) {
+            if (max_intervals <= bounds.size()) {
+                break;
+            }
+            auto overlaps = [&](const std::string& x) {
+                return x.find(gram) != std::string::npos || gram.find(x) != std::string::npos;
+            };
+            if (std::any_of(grams.begin(), grams.end(), overlaps)) {
+                continue;
+            }
+            std::vector<std::string> news = {gram};
+            if (auto succ = successor(gram); succ.has_value()) {
+                news.push_back(std::move(succ.value()));
+            }
+            news.erase(std::remove_if(news.begin(), news.end(),
+                                      [&](const std::string& x) {
+                                          return std::binary_search(bounds.begin(), bounds.end(), x);
+                                      }),
+                       news.end());
+            if (bounds.size() + news.size() <= max_intervals) {
+                bounds.insert(bounds.end(), news.begin(), news.end());
+                normalize(bounds);
+                grams.push_back(gram);
+            }
+        }
+        XCDAT_THROW_IF(max_intervals < bounds.size(), "The number of intervals exceeds the limit.");
+
+        std::vector<char> chars;
+        std::vector<std::uint32_t> offsets;
+        std::vector<std::uint8_t> lengths;
+        for (std::uint64_t i = 0; i < bounds.size(); i++) {
+            offsets.push_back(static_cast<std::uint32_t>(chars.size()));
+            chars.insert(chars.end(), bounds[i].begin(), bounds[i].end());
+
+            // The longest prefix of the lower bound shared by all the strings in the interval.
+            std::uint64_t len = 0;
+            if (used[static_cast<std::uint8_t>(bounds[i][0])]) {
+                for (len = bounds[i].size(); len != 0; len--) {
+                    const auto succ = successor(std::string_view(bounds[i]).substr(0, len));
+                    if (!succ.has_value() || (i + 1 < bounds.size() && bounds[i + 1] <= succ.value())) {
+                        break;
+                    }
+                }
+                XCDAT_THROW_IF(len == 0, "The symbol of an interval must not be empty.");
+            }
+            lengths.push_back(static_cast<std::uint8_t>(len));
+        }
+        offsets.push_back(static_cast<std::uint32_t>(chars.size()));
+
+        std::vector<std::uint64_t> chunks;
+        for (const auto& bound : bounds) {
+            chunks.push_back(get_chunk(bound));
+        }
+
+        for (std::uint64_t c = 0; c < 256; c++) {
+            const std::string lower(1, static_cast<char>(c));
+            const std::string upper = lower + std::string(max_gram_length, '\xFF');
+            m_firsts[c] = static_cast<std::uint8_t>(std::upper_bound(bounds.begin(), bounds.end(), lower) - bounds.begin() - 1);
+            m_lasts[c] = static_cast<std::uint8_t>(std::upper_bound(bounds.begin(), bounds.end(), upper) - bounds.begin() - 1);
+        }
+
+        m_bounds.build(chars);
+        m_chunks.build(chunks);
+        m_offsets.build(offsets);
+        m_lengths.build(lengths);
+    }
+
+    //! Get the number of intervals.
+    inline std::uint64_t num_intervals() const {
+        return m_lengths.size();
+    }
+
+    //! Get the maximum length of the training keywords.
+    inline std::uint64_t max_length() const {
+        return m_max_length;
+    }
+
+    //! Encode the string and store it in 'encoded'.
+    inline void encode(std::string_view str, std::string& encoded) const {
+        encoded.clear();
+        for (std::uint64_t pos = 0; pos < str.size();) {
+            const std::string_view rest = str.substr(pos);
+            const std::uint64_t cd = find_interval(rest);
+            encoded.push_back(static_cast<char>(cd));
+            if (m_lengths[cd] == 0) {
+                encoded.push_back(rest[0]);
+                pos += 1;
+            } else {
+                pos += m_lengths[cd];
+            }
+        }
+    }
+
+    //! Decode the encoded string and append it to 'decoded'.
+    inline void decode(std::string_view encoded, std::string& decoded) const {
+        for (std::uint64_t pos = 0; pos < encoded.size(); pos++) {
+            const auto cd = static_cast<std::uint8_t>(encoded[pos]);
+            if (m_lengths[cd] == 0) {
+                decoded.push_back(encoded[++pos]);
+            } else {
+                decoded.append(m_bounds.data() + m_offsets[cd], m_lengths[cd]);
+            }
+        }
+    }
+
+    //! Get the smallest string larger than all the strings starting with 'str'.
+    //! Return std::nullopt if there is no such string (i.e., str consists of only 0xFF).
+    static std::optional<std::string> successor(std::string_view str) {
+        std::string succ(str);
+        while (!succ.empty() && static_cast<std::uint8_t>(succ.back()) == 0xFF) {
+            succ.pop_back();
+        }
+        if (succ.empty()) {
+            return std::nullopt;
+        }
+        succ.back() = static_cast<char>(static_cast<std::uint8_t>(succ.back()) + 1);
+        return succ;
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_max_length);
+        visitor.visit(m_firsts);
+        visitor.visit(m_lasts);
+        visitor.visit(m_bounds);
+        visitor.visit(m_chunks);
+        visitor.visit(m_offsets);
+        visitor.visit(m_lengths);
+    }
+
+  private:
+    inline std::string_view get_bound(std::uint64_t i) const {
+        return std::string_view(m_bounds.data() + m_offsets[i], m_offsets[i + 1] - m_offsets[i]);
+    }
+
+    // Returns the last interval whose lower bound is not larger than str.
+    // The candidates are the interval containing str[0] and the following ones whose lower bounds start with
+    // str[0], which are compared by the chunks first.
+    inline std::uint64_t find_interval(std::string_view str) const {
+        const auto c = static_cast<std::uint8_t>(str[0]);
+        const std::uint64_t chunk = get_chunk(str);
+
+        std::uint64_t lo = m_firsts[c], hi = m_lasts[c];
+        while (lo < hi) {
+            const std::uint64_t mi = (lo + hi + 1) / 2;
+            if (m_chunks[mi] < chunk || (m_chunks[mi] == chunk && get_bound(mi) <= str)) {
+                lo = mi;
+            } else {
+                hi = mi - 1;
+            }
+        }
+        return lo;
+    }
+
+    // Returns the big-endian integer of the (up to) eight bytes following the first byte of str.
+    static inline std::uint64_t get_chunk(std::string_view str) {
+        std::uint64_t chunk = 0;
+        const std::uint64_t len = std::min<std::uint64_t>(str.size(), 9);
+        for (std::uint64_t i = 1; i < len; i++) {
+            chunk |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(str[i])) << ((8 - i) * 8);
+        }
+        return chunk;
+    }
+
+    static void normalize(std::vector<std::string>& bounds) {
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    }
+
+    // Returns the substrings appearing more than once in the sampled keywords in decreasing order of the gains,
+    // i.e., the number of bytes saved by encoding them in one byte.
+    template <class Strings>
+    static std::vector<std::string> select_candidates(const Strings& keys) {
+        std::string sample;
+        std::vector<std::uint64_t> ends;
+
+        std::uint64_t num_bytes = 0;
+        for (const auto& key : keys) {
+            num_bytes += key.size();
+        }
+
+        // Sample the keywords at regular intervals.
+        const std::uint64_t step = std::max<std::uint64_t>(1, num_bytes / max_sample_bytes);
+        for (std::uint64_t i = 0; i < keys.size() && sample.size() < max_sample_bytes; i += step) {
+            sample.append(keys[i].begin(), keys[i].end());
+            ends.push_back(sample.size());
+        }
+
+        std::unordered_map<std::string_view, std::uint64_t> freqs;
+        std::uint64_t beg = 0;
+        for (const std::uint64_t end : ends) {
+            for (std::uint64_t i = beg; i < end; i++) {
+                for (std::uint64_t len = 2; len <= max_gram_length && i + len <= end; len++) {
+                    freqs[std::string_view(sample.data() + i, len)] += 1;
+                }
+            }
+            beg = end;
+        }
+
+        std::vector<std::pair<std::uint64_t, std::string_view>> gains;
+        for (const auto& [gram, freq] : freqs) {
+            if (freq > 1) {
+                gains.emplace_back(freq * (gram.size() - 1), gram);
+            }
+        }
+        std::sort(gains.begin(), gains.end(), [](const auto& a, const auto& b) {
+            return a.first != b.first ? a.first > b.first : a.second < b.second;
+        });
+
+        std::vector<std::string> candidates;
+        candidates.reserve(gains.size());
+        for (const auto& [gain, gram] : gains) {
+            candidates.emplace_back(gram);
+        }
+        return candidates;
+    }
+};
+
+}  // namespace xcdat
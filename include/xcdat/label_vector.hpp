@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bit_vector.hpp"
+#include "compact_vector.hpp"
+#include "exception.hpp"
+#include "tail_vector.hpp"
+
+namespace xcdat {
+
+// Labels of path-compressed (unary) chains of internal nodes.
+//
+// When all the keywords under an internal node share the next characters, the node stores them as a label,
+// instead of a chain of nodes each of which has only one child. A trie search matches the label in one step
+// when arriving at the node. The labels are stored in a TAIL vector, and the flags indicate the nodes with
+// labels, whose TAIL positions are stored in the order of the node positions.
+class label_vector {
+  public:
+    //! The minimum length of a label (a shorter chain is not compressed).
+    static constexpr std::uint64_t min_length = 4;
+
+    class builder {
+      private:
+        // Buffer
+        std::vector<std::uint64_t> m_nposs;
+
+        // Released
+        bit_vector::builder m_flags;
+        std::vector<std::uint64_t> m_tposs;
+        tail_vector::builder m_labels;
+
+      public:
+        builder() = default;
+        virtual ~builder() = default;
+
+        builder(const builder&) = delete;
+        builder& operator=(const builder&) = delete;
+
+        builder(builder&&) noexcept = default;
+        builder& operator=(builder&&) noexcept = default;
+
+        void set_label(std::string_view str, std::uint64_t npos) {
+            XCDAT_THROW_IF(str.size() < min_length, "The given label is too short.");
+            m_labels.set_suffix(str, npos);
+            m_nposs.push_back(npos);
+        }
+
+        void complete(std::uint64_t num_units, bool bin_mode) {
+            std::sort(m_nposs.begin(), m_nposs.end());
+
+            m_flags.resize(num_units);
+            for (const std::uint64_t npos : m_nposs) {
+                m_flags.set_bit(npos, true);
+            }
+
+            // The i-th smallest npos has rank i.
+            m_tposs.resize(m_nposs.size());
+            m_labels.complete(bin_mode, [&](std::uint64_t npos, std::uint64_t tpos) {
+                const auto it = std::lower_bound(m_nposs.begin(), m_nposs.end(), npos);
+                m_tposs[std::distance(m_nposs.begin(), it)] = tpos;
+            });
+        }
+
+        friend class label_vector;
+    };
+
+  private:
+    bit_vector m_flags;
+    compact_vector m_tposs;
+    tail_vector m_labels;
+
+  public:
+    label_vector() = default;
+    virtual ~label_vector() = default;
+
+    label_vector(const label_vector&) = delete;
+    label_vector& operator=(const label_vector&) = delete;
+
+    label_vector(label_vector&&) noexcept = default;
+    label_vector& operator=(label_vector&&) noexcept = default;
+
+    explicit label_vector(builder&& b) : m_flags(b.m_flags, true), m_labels(std::move(b.m_labels)) {
+        if (!b.m_tposs.empty()) {
+            m_tposs = compact_vector(b.m_tposs);
+        }
+    }
+
+    //! Check if the node has a label.
+    inline bool has_label(std::uint64_t npos) const {
+        return m_flags[npos];
+    }
+
+    // Returns the label length if the label of the node is a prefix of key.
+    inline std::optional<std::uint64_t> prefix_match(std::string_view key, std::uint64_t npos) const {
+        return m_labels.prefix_match(key, get_tpos(npos));
+    }
+
+    // Checks if key is a prefix of the label of the node.
+    inline bool predictive_match(std::string_view key, std::uint64_t npos) const {
+        return m_labels.predictive_match(key, get_tpos(npos));
+    }
+
+    // Appends the label of the node to decoded.
+    inline void decode(std::uint64_t npos, std::string& decoded) const {
+        m_labels.decode(get_tpos(npos), decoded);
+    }
+
+    // Calls fn(c) for each character c of the label of the node in reverse order until fn returns false.
+    // Returns true if all the characters are scanned.
+    template <class Fn>
+    inline bool reverse_scan(std::uint64_t npos, Fn&& fn) const {
+        return m_labels.reverse_scan(get_tpos(npos), fn);
+    }
+
+    //! Get the number of labels.
+    inline std::uint64_t num_labels() const {
+        return m_tposs.size();
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_flags);
+        visitor.visit(m_tposs);
+        visitor.visit(m_labels);
+    }
+
+  private:
+    inline std::uint64_t get_tpos(std::uint64_t npos) const {
+        return m_tposs[m_flags.rank(npos)];
+    }
+};
+
+}  // namespace xcdat
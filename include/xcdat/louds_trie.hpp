@@ -0,0 +1,505 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "compact_vector.hpp"
+#include "louds_trie_builder.hpp"
+
+namespace xcdat {
+
+//! A compressed string dictionary based on a succinct trie in the level-order unary degree sequence (LOUDS).
+//! 'TailVector' is the data type of TAIL vector storing suffixes.
+//!
+//! The edges of the trie are numbered in the breadth-first order and represented with a few bits and a label
+//! each, instead of the double-array units. The navigation relies on rank/select operations on the bit vectors,
+//! so the lookup is several times slower than that of the trie, while the memory usage is smaller.
+//! It is intended for cold dictionaries where the compression matters more than the speed.
+template <class TailVector = tail_vector>
+class louds_trie {
+  public:
+    using trie_type = louds_trie<TailVector>;
+    using tail_vector_type = TailVector;
+    using code_table_type = code_table;
+
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = (3U << 24) | (tail_vector_type::type_id << 8);
+
+  private:
+    static constexpr std::uint64_t no_epos = UINT64_MAX;
+
+    std::uint64_t m_num_keys = 0;
+    bool m_root_term = false;
+    code_table_type m_table;
+    immutable_vector<char> m_labels;  // the label of each edge
+    bit_vector m_louds;  // the first edge of each internal node (and a sentinel)
+    bit_vector m_has_child;  // the edges to internal nodes
+    bit_vector m_terms;  // the edges to terminal nodes
+    compact_vector m_links;  // the TAIL position of each leaf
+    tail_vector_type m_tvec;
+
+  public:
+    //! Default constructor
+    louds_trie() = default;
+
+    //! Default destructor
+    virtual ~louds_trie() = default;
+
+    //! Copy constructor (deleted)
+    louds_trie(const louds_trie&) = delete;
+
+    //! Copy constructor (deleted)
+    louds_trie& operator=(const louds_trie&) = delete;
+
+    //! Move constructor
+    louds_trie(louds_trie&&) noexcept = default;
+
+    //! Move constructor
+    louds_trie& operator=(louds_trie&&) noexcept = default;
+
+    //! Build the trie from the input keywords, which are lexicographically sorted and unique.
+    //! The arguments are the same as those of trie.
+    template <class Strings>
+    louds_trie(const Strings& keys, bool bin_mode = false)
+        : louds_trie(louds_trie_builder<Strings, tail_vector_type>(keys, bin_mode)) {
+        static_assert(sizeof(char) == sizeof(typename Strings::value_type::value_type));
+    }
+
+    //! Check if the binary mode.
+    inline bool bin_mode() const {
+        return m_tvec.bin_mode();
+    }
+
+    //! Get the number of stored keywords.
+    inline std::uint64_t num_keys() const {
+        return m_num_keys;
+    }
+
+    //! Get the alphabet size.
+    inline std::uint64_t alphabet_size() const {
+        return m_table.alphabet_size();
+    }
+
+    //! Get the maximum length of keywords.
+    inline std::uint64_t max_length() const {
+        return m_table.max_length();
+    }
+
+    //! Get the number of trie nodes (including the root).
+    inline std::uint64_t num_nodes() const {
+        return m_labels.size() + 1;
+    }
+
+    //! Get the number of DA units (the same as the number of nodes since no DA is used).
+    inline std::uint64_t num_units() const {
+        return num_nodes();
+    }
+
+    //! Get the number of unused DA units (always zero).
+    inline std::uint64_t num_free_units() const {
+        return 0;
+    }
+
+    //! Get the length of TAIL vector.
+    inline std::uint64_t tail_length() const {
+        return m_tvec.size();
+    }
+
+    //! Lookup the ID of the keyword.
+    inline std::optional<std::uint64_t> lookup(std::string_view key) const {
+        if (key.size() == 0) {
+            return m_root_term ? std::optional<std::uint64_t>(0) : std::nullopt;
+        }
+
+        std::uint64_t kpos = 0, npos = 0;
+        while (true) {
+            const std::uint64_t epos = find_child(npos, key[kpos++]);
+            if (epos == no_epos) {
+                return std::nullopt;
+            }
+            if (!m_has_child[epos]) {
+                if (!m_tvec.match(get_suffix(key, kpos), get_link(epos))) {
+                    return std::nullopt;
+                }
+                return epos_to_id(epos);
+            }
+            if (kpos == key.size()) {
+                if (!m_terms[epos]) {
+                    return std::nullopt;
+                }
+                return epos_to_id(epos);
+            }
+            npos = get_child(epos);
+        }
+    }
+
+    //! Decode the keyword associated with the ID.
+    inline std::string decode(std::uint64_t id) const {
+        std::string decoded;
+        decoded.reserve(max_length());
+        decode(id, decoded);
+        return decoded;
+    }
+
+    //! Decode the keyword associated with the ID and store it in 'decoded'.
+    //! It can avoid reallocation of memory to store the result.
+    inline void decode(std::uint64_t id, std::string& decoded) const {
+        decoded.clear();
+
+        if (num_keys() <= id || (m_root_term && id == 0)) {
+            return;
+        }
+
+        std::uint64_t epos = id_to_epos(id);
+        const std::uint64_t link = m_has_child[epos] ? 0 : get_link(epos);
+
+        // Append the labels from epos to the root in reverse order.
+        while (true) {
+            decoded.push_back(m_labels[epos]);
+            const std::uint64_t npos = get_parent(epos);
+            if (npos == 0) {
+                break;
+            }
+            epos = m_has_child.select(npos - 1);
+        }
+
+        std::reverse(decoded.begin(), decoded.end());
+        m_tvec.decode(link, decoded);
+    }
+
+    //! An iterator class for common prefix search.
+    //! It enumerates all the keywords contained as prefixes of a given string.
+    //! It should be instantiated via the function 'make_prefix_iterator'.
+    class prefix_iterator {
+      private:
+        const trie_type* m_obj = nullptr;
+        std::string_view m_key;
+        std::uint64_t m_id = 0;
+        std::uint64_t m_kpos = 0;
+        std::uint64_t m_npos = 0;
+        bool is_beg = true;
+        bool is_end = false;
+
+      public:
+        prefix_iterator() = default;
+
+        //! Increment the iterator.
+        //! Return false if the iteration is terminated.
+        inline bool next() {
+            return m_obj != nullptr && m_obj->next_prefix(this);
+        }
+
+        //! Get the result ID.
+        inline std::uint64_t id() const {
+            return m_id;
+        }
+
+        //! Get the result keyword.
+        inline std::string decoded() const {
+            return std::string(m_key.data(), m_kpos);
+        }
+
+        //! Get the reference to the result keyword.
+        //! Note that the referenced data will be changed in the next iteration.
+        inline std::string_view decoded_view() const {
+            return std::string_view(m_key.data(), m_kpos);
+        }
+
+      private:
+        prefix_iterator(const trie_type* obj, std::string_view key) : m_obj(obj), m_key(key) {}
+
+        friend class louds_trie;
+    };
+
+    //! Make the common prefix searcher for the given keyword.
+    inline prefix_iterator make_prefix_iterator(std::string_view key) const {
+        return prefix_iterator(this, key);
+    }
+
+    //! Preform common prefix search for the keyword.
+    inline void prefix_search(std::string_view key,
+                              const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_prefix_iterator(key);
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! An iterator class for predictive search.
+    //! It enumerates all the keywords starting with a given string.
+    //! It should be instantiated via the function 'make_predictive_iterator'.
+    class predictive_iterator {
+      public:
+        struct cursor_type {
+            std::uint64_t kpos;  // the length of the decoded prefix without the label of epos
+            std::uint64_t epos;
+        };
+
+      private:
+        const trie_type* m_obj = nullptr;
+        std::string_view m_key;
+        std::uint64_t m_id = 0;
+        std::string m_decoded;
+        std::vector<cursor_type> m_stack;
+        bool is_beg = true;
+        bool is_end = false;
+
+      public:
+        predictive_iterator() = default;
+
+        //! Increment the iterator.
+        //! Return false if the iteration is terminated.
+        inline bool next() {
+            return m_obj != nullptr && m_obj->next_predictive(this);
+        }
+
+        //! Get the result ID.
+        inline std::uint64_t id() const {
+            return m_id;
+        }
+
+        //! Get the result keyword.
+        inline std::string decoded() const {
+            return m_decoded;
+        }
+
+        //! Get the reference to the result keyword.
+        //! Note that the referenced data will be changed in the next iteration.
+        inline std::string_view decoded_view() const {
+            return m_decoded;
+        }
+
+      private:
+        predictive_iterator(const trie_type* obj, std::string_view key) : m_obj(obj), m_key(key) {}
+
+        friend class louds_trie;
+    };
+
+    //! Make the predictive searcher for the keyword.
+    inline predictive_iterator make_predictive_iterator(std::string_view key) const {
+        return predictive_iterator(this, key);
+    }
+
+    //! Preform predictive search for the keyword.
+    inline void predictive_search(std::string_view key,
+                                  const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_predictive_iterator(key);
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! An iterator class for enumeration.
+    //! It enumerates all the keywords stored in the trie.
+    //! It should be instantiated via the function 'make_enumerative_iterator'.
+    using enumerative_iterator = predictive_iterator;
+
+    //! Make the enumerator.
+    inline enumerative_iterator make_enumerative_iterator() const {
+        return enumerative_iterator(this, "");
+    }
+
+    //! Enumerate all the keywords and their IDs stored in the trie.
+    inline void enumerate(const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        auto itr = make_enumerative_iterator();
+        while (itr.next()) {
+            fn(itr.id(), itr.decoded_view());
+        }
+    }
+
+    //! Visit the members (commonly used for I/O).
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_num_keys);
+        visitor.visit(m_root_term);
+        visitor.visit(m_table);
+        visitor.visit(m_labels);
+        visitor.visit(m_louds);
+        visitor.visit(m_has_child);
+        visitor.visit(m_terms);
+        visitor.visit(m_links);
+        visitor.visit(m_tvec);
+    }
+
+  private:
+    template <class Strings>
+    explicit louds_trie(louds_trie_builder<Strings, tail_vector_type>&& b)
+        : m_num_keys(b.m_keys.size()), m_root_term(b.m_root_term), m_table(std::move(b.m_table)),
+          m_labels(b.m_labels), m_louds(b.m_louds, true, true), m_has_child(b.m_has_child, true, true),
+          m_terms(b.m_terms, true, true), m_links(b.m_links), m_tvec(std::move(b.m_suffixes)) {}
+
+    static constexpr std::string_view get_suffix(std::string_view s, std::uint64_t i) {
+        assert(i <= s.size());
+        return s.substr(i, s.size() - i);
+    }
+
+    inline std::uint64_t num_edges() const {
+        return m_labels.size();
+    }
+
+    // Returns the edge from internal node npos with label c, or no_epos if not found.
+    inline std::uint64_t find_child(std::uint64_t npos, char c) const {
+        const std::uint64_t beg = m_louds.select(npos);
+        if (beg == num_edges()) {
+            return no_epos;  // Only the root can be empty.
+        }
+        const std::uint64_t end = m_louds.successor(beg + 1);
+        const void* found = std::memchr(m_labels.data() + beg, c, end - beg);
+        if (found == nullptr) {
+            return no_epos;
+        }
+        return static_cast<const char*>(found) - m_labels.data();
+    }
+
+    // Returns the internal node reached by edge epos.
+    inline std::uint64_t get_child(std::uint64_t epos) const {
+        return m_has_child.rank(epos) + 1;
+    }
+
+    // Returns the internal node from which edge epos comes.
+    inline std::uint64_t get_parent(std::uint64_t epos) const {
+        return m_louds.rank(epos + 1) - 1;
+    }
+
+    // Returns the TAIL position of leaf edge epos.
+    inline std::uint64_t get_link(std::uint64_t epos) const {
+        return m_links[epos - m_has_child.rank(epos)];
+    }
+
+    inline std::uint64_t epos_to_id(std::uint64_t epos) const {
+        return m_terms.rank(epos) + (m_root_term ? 1 : 0);
+    }
+
+    inline std::uint64_t id_to_epos(std::uint64_t id) const {
+        return m_terms.select(id - (m_root_term ? 1 : 0));
+    }
+
+    // Pushes the edges from internal node npos in the reverse order of labels.
+    inline void push_children(predictive_iterator* itr, std::uint64_t npos) const {
+        const std::uint64_t beg = m_louds.select(npos);
+        if (beg == num_edges()) {
+            return;
+        }
+        const std::uint64_t end = m_louds.successor(beg + 1);
+        for (std::uint64_t epos = end; epos > beg; epos--) {
+            itr->m_stack.push_back({itr->m_decoded.size(), epos - 1});
+        }
+    }
+
+    inline bool next_prefix(prefix_iterator* itr) const {
+        if (itr->is_end) {
+            return false;
+        }
+
+        if (itr->is_beg) {
+            itr->is_beg = false;
+            if (m_root_term) {
+                itr->m_id = 0;
+                return true;
+            }
+        }
+
+        while (itr->m_kpos < itr->m_key.size()) {
+            const std::uint64_t epos = find_child(itr->m_npos, itr->m_key[itr->m_kpos]);
+            if (epos == no_epos) {
+                break;
+            }
+            itr->m_kpos += 1;
+
+            if (!m_has_child[epos]) {
+                itr->is_end = true;
+                const auto matched = m_tvec.prefix_match(get_suffix(itr->m_key, itr->m_kpos), get_link(epos));
+                if (!matched.has_value()) {
+                    itr->m_id = num_keys();
+                    return false;
+                }
+                itr->m_kpos += matched.value();
+                itr->m_id = epos_to_id(epos);
+                return true;
+            }
+
+            itr->m_npos = get_child(epos);
+            if (m_terms[epos]) {
+                itr->m_id = epos_to_id(epos);
+                return true;
+            }
+        }
+
+        itr->is_end = true;
+        itr->m_id = num_keys();
+        return false;
+    }
+
+    inline bool next_predictive(predictive_iterator* itr) const {
+        if (itr->is_end) {
+            return false;
+        }
+
+        if (itr->is_beg) {
+            itr->is_beg = false;
+
+            if (itr->m_key.size() == 0) {
+                push_children(itr, 0);
+                if (m_root_term) {
+                    itr->m_id = 0;
+                    return true;
+                }
+            } else {
+                std::uint64_t kpos = 0, npos = 0, epos = 0;
+                while (kpos < itr->m_key.size()) {
+                    epos = find_child(npos, itr->m_key[kpos++]);
+                    if (epos == no_epos) {
+                        itr->is_end = true;
+                        return false;
+                    }
+                    if (!m_has_child[epos]) {
+                        itr->is_end = true;
+                        const std::uint64_t link = get_link(epos);
+                        if (!m_tvec.predictive_match(get_suffix(itr->m_key, kpos), link)) {
+                            return false;
+                        }
+                        itr->m_id = epos_to_id(epos);
+                        itr->m_decoded.assign(itr->m_key.data(), kpos);
+                        m_tvec.decode(link, itr->m_decoded);
+                        return true;
+                    }
+                    npos = get_child(epos);
+                }
+                // The label of epos is appended when the cursor is popped.
+                itr->m_decoded.assign(itr->m_key.data(), kpos - 1);
+                itr->m_stack.push_back({kpos - 1, epos});
+            }
+        }
+
+        while (!itr->m_stack.empty()) {
+            const auto [kpos, epos] = itr->m_stack.back();
+            itr->m_stack.pop_back();
+
+            itr->m_decoded.resize(kpos);
+            itr->m_decoded.push_back(m_labels[epos]);
+
+            if (!m_has_child[epos]) {
+                itr->m_id = epos_to_id(epos);
+                m_tvec.decode(get_link(epos), itr->m_decoded);
+                return true;
+            }
+
+            push_children(itr, get_child(epos));
+
+            if (m_terms[epos]) {
+                itr->m_id = epos_to_id(epos);
+                return true;
+            }
+        }
+
+        itr->is_end = true;
+        return false;
+    }
+};
+
+}  // namespace xcdat
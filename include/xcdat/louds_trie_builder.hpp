@@ -0,0 +1,129 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "bit_vector.hpp"
+#include "code_table.hpp"
+#include "exception.hpp"
+#include "tail_vector.hpp"
+
+namespace xcdat {
+
+template <class Strings, class TailVector>
+class louds_trie_builder {
+    template <class>
+    friend class louds_trie;
+
+  private:
+    // Keywords in [beg, end) sharing the prefix of length depth, corresponding to an internal node.
+    struct range_type {
+        std::uint64_t beg;
+        std::uint64_t end;
+        std::uint64_t depth;
+    };
+
+    const Strings& m_keys;
+
+    bool m_bin_mode = false;
+    bool m_root_term = false;
+
+    code_table m_table;
+    std::vector<char> m_labels;
+    bit_vector::builder m_louds;
+    bit_vector::builder m_has_child;
+    bit_vector::builder m_terms;
+    std::vector<std::uint64_t> m_links;
+    typename TailVector::builder m_suffixes;
+
+  public:
+    explicit louds_trie_builder(const Strings& keys, bool bin_mode) : m_keys(keys), m_bin_mode(bin_mode) {
+        XCDAT_THROW_IF(m_keys.size() == 0, "The input dataset is empty.");
+
+        for (std::uint64_t i = 1; i < m_keys.size(); i++) {
+            const std::string_view prev{m_keys[i - 1].data(), m_keys[i - 1].size()};
+            const std::string_view curr{m_keys[i].data(), m_keys[i].size()};
+            XCDAT_THROW_IF(curr == prev, "The input keys are not unique.");
+            XCDAT_THROW_IF(curr < prev, "The input keys are not in lexicographical order.");
+        }
+
+        // Build the code table
+        m_table = code_table(keys);
+        m_bin_mode |= m_table.has_null();
+
+        // Build the LOUDS edges
+        arrange();
+
+        // Build the TAIL vector
+        m_suffixes.complete(m_bin_mode, [&](std::uint64_t lpos, std::uint64_t tpos) { m_links[lpos] = tpos; });
+    }
+
+    virtual ~louds_trie_builder() = default;
+
+    louds_trie_builder(const louds_trie_builder&) = delete;
+    louds_trie_builder& operator=(const louds_trie_builder&) = delete;
+
+    louds_trie_builder(louds_trie_builder&&) noexcept = default;
+    louds_trie_builder& operator=(louds_trie_builder&&) noexcept = default;
+
+  private:
+    inline std::string_view get_key(std::uint64_t i) const {
+        return std::string_view(m_keys[i].data(), m_keys[i].size());
+    }
+
+    // Visits the internal nodes in the breadth-first order and defines the edges to their children.
+    // A child reached by only one keyword becomes a leaf, and the rest of the keyword is stored in TAIL.
+    void arrange() {
+        std::vector<range_type> queue;
+        queue.push_back({0, m_keys.size(), 0});
+
+        if (get_key(0).size() == 0) {
+            m_root_term = true;
+            queue[0].beg += 1;
+        }
+
+        for (std::uint64_t qpos = 0; qpos < queue.size(); qpos++) {
+            const auto [beg, end, depth] = queue[qpos];
+
+            bool is_first = true;
+            for (std::uint64_t i = beg; i < end;) {
+                const char c = get_key(i)[depth];
+
+                std::uint64_t j = i + 1;
+                while (j < end && get_key(j)[depth] == c) {
+                    j += 1;
+                }
+
+                m_labels.push_back(c);
+                m_louds.push_back(is_first);
+                is_first = false;
+
+                if (j - i == 1) {
+                    const std::string_view suffix = get_key(i).substr(depth + 1);
+                    if (suffix.size() != 0) {
+                        m_suffixes.set_suffix(suffix, m_links.size());
+                    }
+                    m_links.push_back(0);
+                    m_has_child.push_back(false);
+                    m_terms.push_back(true);
+                } else {
+                    const bool is_term = get_key(i).size() == depth + 1;
+                    m_has_child.push_back(true);
+                    m_terms.push_back(is_term);
+                    queue.push_back({is_term ? i + 1 : i, j, depth + 1});
+                }
+                i = j;
+            }
+        }
+
+        // Sentinel to find the end of the last node
+        m_louds.push_back(true);
+
+        // Dummy for the trie only with the empty keyword, since compact_vector cannot be empty
+        if (m_links.empty()) {
+            m_links.push_back(0);
+        }
+    }
+};
+
+}  // namespace xcdat
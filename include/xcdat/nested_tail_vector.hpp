@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "bc_vector_8.hpp"
+#include "exception.hpp"
+#include "tail_vector.hpp"
+#include "trie.hpp"
+
+namespace xcdat {
+
+// A TAIL vector whose suffixes are stored in a nested trie, following Yata's nesting of prefix tries.
+//
+// The distinct suffixes are reversed and inserted into a second-level trie, so that suffixes sharing
+// the same ending share trie nodes. A suffix is identified by the ID of its reversed string, and it is
+// read from the first character by walking the nested trie from the leaf to the root. The suffixes of
+// the nested trie are recursively stored in the same manner until 'Levels' nested tries are made,
+// and the deepest one uses the plain TAIL vector.
+template <std::uint64_t Levels>
+class nested_tail_vector {
+    static_assert(Levels != 0, "Levels must be positive.");
+
+  public:
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = 1 + Levels;
+
+    using inner_tail_vector_type = std::conditional_t<(Levels > 1), nested_tail_vector<Levels - 1>, tail_vector>;
+    using inner_trie_type = trie<bc_vector_8, inner_tail_vector_type>;
+
+    class builder {
+      private:
+        using suffix_type = tail_vector::suffix_type;
+
+        // Buffer
+        std::vector<suffix_type> m_suffixes;
+
+        // Released
+        bool m_bin_mode = false;
+        inner_trie_type m_trie;
+
+      public:
+        builder() = default;
+        virtual ~builder() = default;
+
+        builder(const builder&) = delete;
+        builder& operator=(const builder&) = delete;
+
+        builder(builder&&) noexcept = default;
+        builder& operator=(builder&&) noexcept = default;
+
+        void set_suffix(std::string_view str, std::uint64_t npos) {
+            XCDAT_THROW_IF(str.size() == 0, "The given suffix is empty.");
+            m_suffixes.push_back({str, npos});
+        }
+
+        // setter(npos, tpos): Set units[npos].base = tpos.
+        void complete(bool bin_mode, const std::function<void(std::uint64_t, std::uint64_t)>& setter) {
+            m_bin_mode = bin_mode;
+
+            if (m_suffixes.empty()) {
+                return;
+            }
+
+            std::vector<std::string> rev_keys;
+            rev_keys.reserve(m_suffixes.size());
+            for (const auto& suffix : m_suffixes) {
+                rev_keys.emplace_back(suffix.str.rbegin(), suffix.str.rend());
+            }
+            std::sort(rev_keys.begin(), rev_keys.end());
+            rev_keys.erase(std::unique(rev_keys.begin(), rev_keys.end()), rev_keys.end());
+
+            m_trie = inner_trie_type(rev_keys, bin_mode);
+
+            // The position 0 is reserved for the empty suffix.
+            std::string rev_key;
+            for (const auto& suffix : m_suffixes) {
+                rev_key.assign(suffix.str.rbegin(), suffix.str.rend());
+                setter(suffix.npos, m_trie.lookup(rev_key).value() + 1);
+            }
+        }
+
+        friend class nested_tail_vector;
+    };
+
+  private:
+    bool m_bin_mode = false;
+    inner_trie_type m_trie;
+
+  public:
+    nested_tail_vector() = default;
+    virtual ~nested_tail_vector() = default;
+
+    nested_tail_vector(const nested_tail_vector&) = delete;
+    nested_tail_vector& operator=(const nested_tail_vector&) = delete;
+
+    nested_tail_vector(nested_tail_vector&&) noexcept = default;
+    nested_tail_vector& operator=(nested_tail_vector&&) noexcept = default;
+
+    explicit nested_tail_vector(builder&& b) : m_bin_mode(b.m_bin_mode), m_trie(std::move(b.m_trie)) {}
+
+    inline bool bin_mode() const {
+        return m_bin_mode;
+    }
+
+    inline bool match(std::string_view key, std::uint64_t tpos) const {
+        std::uint64_t kpos = 0;
+        const bool scanned = scan(tpos, [&](char c) {
+            if (kpos == key.size() || key[kpos] != c) {
+                return false;
+            }
+            kpos += 1;
+            return true;
+        });
+        return scanned && kpos == key.size();
+    }
+
+    // Returns epos-tpos+1 if TAIL[tpos..epos] is a prefix of key.
+    inline std::optional<std::uint64_t> prefix_match(std::string_view key, std::uint64_t tpos) const {
+        std::uint64_t kpos = 0;
+        const bool scanned = scan(tpos, [&](char c) {
+            if (kpos == key.size() || key[kpos] != c) {
+                return false;
+            }
+            kpos += 1;
+            return true;
+        });
+        if (!scanned) {
+            return std::nullopt;
+        }
+        return kpos;
+    }
+
+    // Checks if key is a prefix of TAIL[tpos..epos].
+    inline bool predictive_match(std::string_view key, std::uint64_t tpos) const {
+        std::uint64_t kpos = 0;
+        bool mismatched = false;
+        scan(tpos, [&](char c) {
+            if (kpos == key.size()) {
+                return false;
+            }
+            if (key[kpos] != c) {
+                mismatched = true;
+                return false;
+            }
+            kpos += 1;
+            return true;
+        });
+        return !mismatched && kpos == key.size();
+    }
+
+    // Appends TAIL[tpos..epos] to decoded.
+    inline void decode(std::uint64_t tpos, std::string& decoded) const {
+        scan(tpos, [&](char c) {
+            decoded.push_back(c);
+            return true;
+        });
+    }
+
+    // Calls fn(c) for each character c of TAIL[tpos..epos] in reverse order until fn returns false.
+    // Returns true if all the characters are scanned.
+    template <class Fn>
+    inline bool reverse_scan(std::uint64_t tpos, Fn&& fn) const {
+        if (tpos == 0) {
+            return true;
+        }
+        // The reversed suffix is the keyword stored in the nested trie.
+        const std::string rev_key = m_trie.decode(tpos - 1);
+        for (const char c : rev_key) {
+            if (!fn(c)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Get the number of distinct suffixes.
+    inline std::uint64_t size() const {
+        return m_trie.num_keys();
+    }
+
+    //! Get the nested trie.
+    inline const inner_trie_type& nested_trie() const {
+        return m_trie;
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_bin_mode);
+        visitor.visit(m_trie);
+    }
+
+  private:
+    // Calls fn(c) for each character c of TAIL[tpos..epos] until fn returns false.
+    // Returns true if all the characters are scanned.
+    template <class Fn>
+    inline bool scan(std::uint64_t tpos, Fn&& fn) const {
+        if (tpos == 0) {
+            return true;
+        }
+        return m_trie.reverse_scan(tpos - 1, fn);
+    }
+};
+
+}  // namespace xcdat
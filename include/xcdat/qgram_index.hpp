@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "compact_vector.hpp"
+#include "exception.hpp"
+#include "immutable_vector.hpp"
+
+namespace xcdat {
+
+// An inverted index from q-grams (substrings of q bytes) of strings to the sorted IDs of the strings.
+//
+// The distinct q-grams are stored in the sorted order, and the posting list of the i-th q-gram is stored in
+// m_postings from m_heads[i] to m_heads[i+1], as the number of IDs and the gaps of the IDs in variable bytes.
+// A q-gram is found by binary search. The strings shorter than q bytes have no q-grams.
+class qgram_index {
+  public:
+    static constexpr std::uint64_t q = 3;
+
+  private:
+    compact_vector m_grams;  // sorted q-grams, followed by a sentinel
+    compact_vector m_heads;  // positions of the posting lists in m_postings, followed by the end position
+    immutable_vector<char> m_postings;
+
+  public:
+    qgram_index() = default;
+    virtual ~qgram_index() = default;
+
+    qgram_index(const qgram_index&) = delete;
+    qgram_index& operator=(const qgram_index&) = delete;
+
+    qgram_index(qgram_index&&) noexcept = default;
+    qgram_index& operator=(qgram_index&&) noexcept = default;
+
+    // Builds the index from the strings, where the ID of strs[i] is ids[i].
+    template <class Strings>
+    qgram_index(const Strings& strs, const std::vector<std::uint64_t>& ids) {
+        XCDAT_THROW_IF(strs.size() != ids.size(), "The numbers of strings and IDs are different.");
+        XCDAT_THROW_IF(1ULL << (64 - 8 * q) <= strs.size(), "The number of strings is too large.");
+
+        // Pairs of a q-gram and an ID packed in an integer
+        std::vector<std::uint64_t> pairs;
+        for (std::uint64_t i = 0; i < strs.size(); i++) {
+            const std::string_view str(strs[i].data(), strs[i].size());
+            for (std::uint64_t j = 0; j + q <= str.size(); j++) {
+                pairs.push_back((get_gram(str, j) << (64 - 8 * q)) | ids[i]);
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+        std::vector<std::uint64_t> grams;
+        std::vector<std::uint64_t> heads;
+        std::vector<char> postings;
+
+        for (std::uint64_t i = 0; i < pairs.size();) {
+            const std::uint64_t gram = pairs[i] >> (64 - 8 * q);
+            std::uint64_t j = i;
+            while (j < pairs.size() && (pairs[j] >> (64 - 8 * q)) == gram) {
+                j += 1;
+            }
+            grams.push_back(gram);
+            heads.push_back(postings.size());
+            put_vbyte(postings, j - i);
+            for (std::uint64_t prev = 0; i < j; i++) {
+                const std::uint64_t id = pairs[i] & id_mask();
+                put_vbyte(postings, id - prev);
+                prev = id;
+            }
+        }
+        grams.push_back(1ULL << (8 * q));
+        heads.push_back(postings.size());
+
+        m_grams = compact_vector(grams);
+        m_heads = compact_vector(heads);
+        m_postings.build(postings);
+    }
+
+    // Returns the sorted IDs of the strings containing all the q-grams of the pattern, which must be
+    // at least q bytes long. The strings should be verified since the q-grams may appear at other positions.
+    inline std::vector<std::uint64_t> candidates(std::string_view pattern) const {
+        assert(q <= pattern.size());
+
+        // Posting lists of the distinct q-grams, in the increasing order of their sizes
+        std::vector<std::pair<std::uint64_t, const char*>> lists;
+        for (std::uint64_t j = 0; j + q <= pattern.size(); j++) {
+            const auto i = find(get_gram(pattern, j));
+            if (!i.has_value()) {
+                return {};
+            }
+            const char* ptr = m_postings.data() + m_heads[i.value()];
+            const std::uint64_t size = get_vbyte(ptr);
+            lists.emplace_back(size, ptr);
+        }
+        std::sort(lists.begin(), lists.end());
+        lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+        std::vector<std::uint64_t> results = decode_list(lists[0].first, lists[0].second);
+        for (std::uint64_t k = 1; k < lists.size() && !results.empty(); k++) {
+            intersect(results, lists[k].first, lists[k].second);
+        }
+        return results;
+    }
+
+    inline std::uint64_t num_grams() const {
+        return m_grams.size() - 1;
+    }
+
+    inline std::uint64_t num_bytes() const {
+        return m_postings.size();
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_grams);
+        visitor.visit(m_heads);
+        visitor.visit(m_postings);
+    }
+
+  private:
+    static constexpr std::uint64_t id_mask() {
+        return (1ULL << (64 - 8 * q)) - 1;
+    }
+
+    static inline std::uint64_t get_gram(std::string_view str, std::uint64_t pos) {
+        std::uint64_t gram = 0;
+        for (std::uint64_t i = 0; i < q; i++) {
+            gram = (gram << 8) | static_cast<std::uint8_t>(str[pos + i]);
+        }
+        return gram;
+    }
+
+    inline std::optional<std::uint64_t> find(std::uint64_t gram) const {
+        std::uint64_t lo = 0, hi = num_grams();
+        while (lo < hi) {
+            const std::uint64_t mid = (lo + hi) / 2;
+            if (m_grams[mid] < gram) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (m_grams[lo] != gram) {
+            return std::nullopt;
+        }
+        return lo;
+    }
+
+    static std::vector<std::uint64_t> decode_list(std::uint64_t size, const char* ptr) {
+        std::vector<std::uint64_t> ids(size);
+        for (std::uint64_t i = 0, id = 0; i < size; i++) {
+            id += get_vbyte(ptr);
+            ids[i] = id;
+        }
+        return ids;
+    }
+
+    // Keeps the IDs in 'ids' also contained in the posting list.
+    static void intersect(std::vector<std::uint64_t>& ids, std::uint64_t size, const char* ptr) {
+        std::uint64_t num_ids = 0;
+        std::uint64_t id = 0;
+        for (std::uint64_t i = 0, k = 0; i < size && k < ids.size(); i++) {
+            id += get_vbyte(ptr);
+            while (k < ids.size() && ids[k] < id) {
+                k += 1;
+            }
+            if (k < ids.size() && ids[k] == id) {
+                ids[num_ids++] = id;
+                k += 1;
+            }
+        }
+        ids.resize(num_ids);
+    }
+
+    static void put_vbyte(std::vector<char>& bytes, std::uint64_t x) {
+        while (128 <= x) {
+            bytes.push_back(static_cast<char>((x & 127) | 128));
+            x >>= 7;
+        }
+        bytes.push_back(static_cast<char>(x));
+    }
+
+    static inline std::uint64_t get_vbyte(const char*& ptr) {
+        std::uint64_t x = 0;
+        for (std::uint64_t shift = 0;; shift += 7) {
+            const auto c = static_cast<std::uint8_t>(*ptr++);
+            x |= static_cast<std::uint64_t>(c & 127) << shift;
+            if (c < 128) {
+                return x;
+            }
+        }
+    }
+};
+
+}  // namespace xcdat
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <cmath>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "compact_vector.hpp"
+#include "trie.hpp"
+
+namespace xcdat {
+
+//! An approximate membership filter supporting point and range queries, in the manner of SuRF [Zhang et al. 2018].
+//! 'BcVector' is the data type of Base and Check vectors.
+//!
+//! Each keyword is truncated to the shortest prefix distinguishing it from the other keywords, and only the
+//! truncated keywords are stored in the double-array trie, so that TAIL vector is almost empty. A few bits are
+//! kept for each truncated keyword: hash bits of the whole keyword (suffix_mode::hash), or the first bits of the
+//! removed suffix (suffix_mode::real). The queries never return false negatives, while they can return false
+//! positives. Hash bits give a false positive rate of about 2^-b for point queries, and real bits also narrow
+//! range queries.
+template <class BcVector>
+class range_filter {
+  public:
+    using trie_type = trie<BcVector>;
+    using bc_vector_type = BcVector;
+
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = (4U << 24) | bc_vector_type::l1_bits;
+
+    //! The maximum number of suffix bits per keyword.
+    static constexpr std::uint64_t max_suffix_bits = 32;
+
+    //! The kind of suffix bits kept for each truncated keyword.
+    enum class suffix_mode : std::uint8_t {
+        hash = 0,  // for point queries
+        real = 1,  // for point and range queries
+    };
+
+  private:
+    suffix_mode m_mode = suffix_mode::real;
+    std::uint64_t m_suffix_bits = 0;
+    trie_type m_trie;
+    bit_vector m_fulls;  // whether the keyword of each ID is stored without truncation
+    compact_vector m_suffixes;  // the suffix bits of each ID
+
+  public:
+    //! Default constructor
+    range_filter() = default;
+
+    //! Default destructor
+    virtual ~range_filter() = default;
+
+    //! Copy constructor (deleted)
+    range_filter(const range_filter&) = delete;
+
+    //! Copy constructor (deleted)
+    range_filter& operator=(const range_filter&) = delete;
+
+    //! Move constructor
+    range_filter(range_filter&&) noexcept = default;
+
+    //! Move constructor
+    range_filter& operator=(range_filter&&) noexcept = default;
+
+    //! Build the filter from the input keywords, which are lexicographically sorted and unique.
+    //! 'suffix_bits' is the number of suffix bits per keyword, up to max_suffix_bits
+    //! (see suffix_bits_for to derive it from a false positive rate).
+    template <class Strings>
+    range_filter(const Strings& keys, std::uint64_t suffix_bits = 8, suffix_mode mode = suffix_mode::real)
+        : m_mode(mode), m_suffix_bits(suffix_bits) {
+        XCDAT_THROW_IF(keys.size() == 0, "The input dataset is empty.");
+        XCDAT_THROW_IF(max_suffix_bits < suffix_bits, "The number of suffix bits is too large.");
+
+        auto get_key = [&](std::uint64_t i) { return std::string_view(keys[i].data(), keys[i].size()); };
+        auto get_lcp = [&](std::uint64_t i) {  // of the (i-1)-th and i-th keywords
+            const std::string_view prev = get_key(i - 1), curr = get_key(i);
+            XCDAT_THROW_IF(curr == prev, "The input keys are not unique.");
+            XCDAT_THROW_IF(curr < prev, "The input keys are not in lexicographical order.");
+            std::uint64_t lcp = 0;
+            while (lcp < prev.size() && lcp < curr.size() && prev[lcp] == curr[lcp]) {
+                ++lcp;
+            }
+            return lcp;
+        };
+
+        // Truncate the keywords to the distinguishing prefixes.
+        std::vector<std::string> truncated(keys.size());
+        {
+            std::uint64_t prev_lcp = 0;
+            for (std::uint64_t i = 0; i < keys.size(); i++) {
+                const std::uint64_t next_lcp = i + 1 < keys.size() ? get_lcp(i + 1) : 0;
+                const std::string_view key = get_key(i);
+                truncated[i] = key.substr(0, std::min<std::uint64_t>(std::max(prev_lcp, next_lcp) + 1, key.size()));
+                prev_lcp = next_lcp;
+            }
+        }
+        m_trie = trie_type(truncated);
+
+        bit_vector::builder fulls(keys.size());
+        std::vector<std::uint64_t> suffixes(keys.size());
+        for (std::uint64_t i = 0; i < keys.size(); i++) {
+            const std::uint64_t id = m_trie.lookup(truncated[i]).value();
+            const std::string_view key = get_key(i);
+            if (truncated[i].size() == key.size()) {
+                fulls.set_bit(id);
+            } else {
+                suffixes[id] = get_suffix_bits(key, truncated[i].size());
+            }
+        }
+        m_fulls = bit_vector(fulls);
+        m_suffixes = compact_vector(suffixes);
+    }
+
+    //! Get the number of suffix bits to achieve the false positive rate of point queries with hash bits.
+    static std::uint64_t suffix_bits_for(double fpr) {
+        XCDAT_THROW_IF(fpr <= 0.0 || 1.0 < fpr, "The false positive rate must be in (0,1].");
+        const auto bits = static_cast<std::uint64_t>(std::ceil(-std::log2(fpr)));
+        return std::min(bits, max_suffix_bits);
+    }
+
+    //! Get the number of stored keywords.
+    inline std::uint64_t num_keys() const {
+        return m_trie.num_keys();
+    }
+
+    //! Get the number of suffix bits per keyword.
+    inline std::uint64_t suffix_bits() const {
+        return m_suffix_bits;
+    }
+
+    //! Get the kind of suffix bits.
+    inline suffix_mode mode() const {
+        return m_mode;
+    }
+
+    //! Get the trie storing the truncated keywords.
+    inline const trie_type& truncated_trie() const {
+        return m_trie;
+    }
+
+    //! Check if the keyword may be stored.
+    //! It returns true for every stored keyword, and can return true for other strings.
+    inline bool may_contain(std::string_view key) const {
+        const auto found = find_longest_prefix(key);
+        if (!found.has_value()) {
+            return false;
+        }
+        const auto [id, len] = found.value();
+        if (m_fulls[id]) {
+            return len == key.size();
+        }
+        return m_suffixes[id] == get_suffix_bits(key, len);
+    }
+
+    //! Check if a keyword in [lo, hi] may be stored.
+    //! It returns true if such a keyword is stored, and can return true otherwise.
+    inline bool may_contain_range(std::string_view lo, std::string_view hi) const {
+        if (hi < lo) {
+            return false;
+        }
+
+        // The truncated keyword that is a prefix of lo is smaller than the others not less than lo.
+        if (const auto found = find_longest_prefix(lo); found.has_value()) {
+            const auto [id, len] = found.value();
+            if (m_fulls[id]) {
+                if (len == lo.size()) {
+                    return true;
+                }
+            } else if (0 <= compare_suffix(id, lo, len)) {
+                // The keyword may be not less than lo.
+                if (hi.substr(0, len) != lo.substr(0, len)) {
+                    return true;
+                }
+                return compare_suffix(id, hi, len) <= 0;
+            }
+        }
+
+        // The smallest truncated keyword not less than lo.
+        auto itr = m_trie.make_lower_bound_iterator(lo);
+        if (!itr.next()) {
+            return false;
+        }
+        const std::string_view truncated = itr.decoded_view();
+        if (m_fulls[itr.id()]) {
+            return truncated <= hi;
+        }
+        if (hi.substr(0, truncated.size()) == truncated) {
+            return compare_suffix(itr.id(), hi, truncated.size()) <= 0;
+        }
+        return truncated < hi;
+    }
+
+    //! Visit the members (commonly used for I/O).
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_mode);
+        visitor.visit(m_suffix_bits);
+        visitor.visit(m_trie);
+        visitor.visit(m_fulls);
+        visitor.visit(m_suffixes);
+    }
+
+  private:
+    // Returns the ID and length of the longest truncated keyword that is a prefix of the string.
+    inline std::optional<std::pair<std::uint64_t, std::uint64_t>> find_longest_prefix(std::string_view str) const {
+        std::optional<std::pair<std::uint64_t, std::uint64_t>> found;
+        auto itr = m_trie.make_prefix_iterator(str);
+        while (itr.next()) {
+            found = std::make_pair(itr.id(), itr.decoded_view().size());
+        }
+        return found;
+    }
+
+    // Returns the suffix bits of str[pos..] (or of the whole str with suffix_mode::hash).
+    inline std::uint64_t get_suffix_bits(std::string_view str, std::uint64_t pos) const {
+        if (m_suffix_bits == 0) {
+            return 0;
+        }
+        if (m_mode == suffix_mode::hash) {
+            return hash(str) & ((1ULL << m_suffix_bits) - 1);
+        }
+        std::uint64_t x = 0;
+        for (std::uint64_t i = 0; i < max_suffix_bits / 8; i++) {
+            x = (x << 8) | (pos + i < str.size() ? static_cast<std::uint8_t>(str[pos + i]) : 0);
+        }
+        return x >> (max_suffix_bits - m_suffix_bits);
+    }
+
+    // Compares the truncated keyword of the ID with str[pos..] by the real suffix bits.
+    // Returns a negative (or positive) value if the keyword is certainly smaller (or larger) than str,
+    // or zero if unknown.
+    inline int compare_suffix(std::uint64_t id, std::string_view str, std::uint64_t pos) const {
+        if (m_mode != suffix_mode::real) {
+            return 0;
+        }
+        const std::uint64_t x = m_suffixes[id];
+        const std::uint64_t y = get_suffix_bits(str, pos);
+        return x < y ? -1 : (y < x ? 1 : 0);
+    }
+
+    // FNV-1a with the finalizer of MurmurHash3
+    static inline std::uint64_t hash(std::string_view str) {
+        std::uint64_t h = 0xCBF29CE484222325ULL;
+        for (const char c : str) {
+            h = (h ^ static_cast<std::uint8_t>(c)) * 0x100000001B3ULL;
+        }
+        h = (h ^ (h >> 33)) * 0xFF51AFD7ED558CCDULL;
+        h = (h ^ (h >> 33)) * 0xC4CEB9FE1A85EC53ULL;
+        return h ^ (h >> 33);
+    }
+};
+
+}  // namespace xcdat
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "compact_vector.hpp"
+#include "exception.hpp"
+#include "tail_vector.hpp"
+
+namespace xcdat {
+
+// A TAIL vector compressed with a Re-Pair-like grammar.
+//
+// The suffixes are stored as a sequence of symbols, each suffix followed by the terminator symbol 0.
+// Symbols 1..256 represent the bytes 0x00..0xFF, and the other symbols represent rules, each of which is
+// expanded into a pair of symbols. Rules never span two suffixes, so every suffix can be decoded sequentially
+// from its position in the sequence. Since the terminator is a distinct symbol, the keywords can contain
+// NULL characters without any additional data.
+class repair_tail_vector {
+  public:
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = 1;
+
+    //! The maximum height of the grammar tree (i.e., the stack size needed for expansion).
+    static constexpr std::uint64_t max_height = 32;
+
+    //! The minimum frequency of a pair to be replaced with a rule.
+    static constexpr std::uint64_t min_freq = 3;
+
+    class builder {
+      private:
+        using suffix_type = tail_vector::suffix_type;
+
+        // Buffer
+        std::vector<suffix_type> m_suffixes;
+
+        // Released
+        bool m_bin_mode = false;
+        std::vector<std::uint64_t> m_seq;
+        std::vector<std::uint64_t> m_rules;
+
+      public:
+        builder() = default;
+        virtual ~builder() = default;
+
+        builder(const builder&) = delete;
+        builder& operator=(const builder&) = delete;
+
+        builder(builder&&) noexcept = default;
+        builder& operator=(builder&&) noexcept = default;
+
+        void set_suffix(std::string_view str, std::uint64_t npos) {
+            XCDAT_THROW_IF(str.size() == 0, "The given suffix is empty.");
+            m_suffixes.push_back({str, npos});
+        }
+
+        // setter(npos, tpos): Set units[npos].base = tpos.
+        void complete(bool bin_mode, const std::function<void(std::uint64_t, std::uint64_t)>& setter) {
+            m_bin_mode = bin_mode;
+
+            // Identical suffixes share the same position.
+            std::sort(m_suffixes.begin(), m_suffixes.end(),
+                      [](const suffix_type& a, const suffix_type& b) { return a.str < b.str; });
+
+            // Dummy for an empty suffix
+            m_seq.push_back(0);
+
+            std::vector<std::uint64_t> tposs;
+            tposs.reserve(m_suffixes.size());
+
+            for (std::uint64_t i = 0; i < m_suffixes.size(); i++) {
+                if (i == 0 || m_suffixes[i - 1].str != m_suffixes[i].str) {
+                    tposs.push_back(m_seq.size());
+                    for (const char c : m_suffixes[i].str) {
+                        m_seq.push_back(static_cast<std::uint8_t>(c) + 1ULL);
+                    }
+                    m_seq.push_back(0);
+                } else {
+                    tposs.push_back(tposs.back());
+                }
+            }
+
+            compress();
+
+            // Since rules never contain the terminator, the j-th suffix starts after the j-th terminator.
+            std::vector<std::uint64_t> starts = {0};
+            for (std::uint64_t i = 0; i + 1 < m_seq.size(); i++) {
+                if (m_seq[i] == 0) {
+                    starts.push_back(i + 1);
+                }
+            }
+
+            std::uint64_t j = 0;
+            for (std::uint64_t i = 0; i < m_suffixes.size(); i++) {
+                if (i != 0 && m_suffixes[i - 1].str != m_suffixes[i].str) {
+                    j += 1;
+                }
+                setter(m_suffixes[i].npos, starts[j + 1]);
+            }
+        }
+
+      private:
+        inline static std::uint64_t make_pair(std::uint64_t a, std::uint64_t b) {
+            return (a << 32) | b;
+        }
+
+        void compress() {
+            std::vector<std::uint64_t> heights;  // heights of rules
+            std::unordered_map<std::uint64_t, std::uint64_t> counts;
+            std::unordered_map<std::uint64_t, std::uint64_t> selected;  // pair -> symbol
+
+            auto get_height = [&](std::uint64_t sym) -> std::uint64_t {
+                return sym <= 256 ? 0 : heights[sym - 257];
+            };
+
+            while (true) {
+                counts.clear();
+                for (std::uint64_t i = 0; i + 1 < m_seq.size(); i++) {
+                    if (m_seq[i] != 0 && m_seq[i + 1] != 0) {
+                        counts[make_pair(m_seq[i], m_seq[i + 1])] += 1;
+                        // Do not count overlapping pairs in a run such as 'aaa'.
+                        if (m_seq[i] == m_seq[i + 1] && i + 2 < m_seq.size() && m_seq[i + 1] == m_seq[i + 2]) {
+                            i += 1;
+                        }
+                    }
+                }
+
+                // Select the frequent pairs in this round.
+                std::vector<std::pair<std::uint64_t, std::uint64_t>> cands;  // (freq, pair)
+                for (const auto& [pair, freq] : counts) {
+                    if (freq < min_freq) {
+                        continue;
+                    }
+                    const std::uint64_t height = std::max(get_height(pair >> 32), get_height(pair & 0xFFFFFFFFULL));
+                    if (height + 1 < max_height) {
+                        cands.emplace_back(freq, pair);
+                    }
+                }
+                if (cands.empty()) {
+                    break;
+                }
+                std::sort(cands.begin(), cands.end(), std::greater<>());
+
+                selected.clear();
+                const std::uint64_t threshold = std::max(min_freq, cands[0].first / 2);
+                for (const auto& [freq, pair] : cands) {
+                    if (freq < threshold) {
+                        break;
+                    }
+                    const std::uint64_t a = pair >> 32, b = pair & 0xFFFFFFFFULL;
+                    selected[pair] = 257 + m_rules.size() / 2;
+                    heights.push_back(std::max(get_height(a), get_height(b)) + 1);
+                    m_rules.push_back(a);
+                    m_rules.push_back(b);
+                }
+
+                // Replace the selected pairs greedily from left to right.
+                std::uint64_t j = 0;
+                for (std::uint64_t i = 0; i < m_seq.size(); i++) {
+                    if (i + 1 < m_seq.size() && m_seq[i] != 0 && m_seq[i + 1] != 0) {
+                        auto it = selected.find(make_pair(m_seq[i], m_seq[i + 1]));
+                        if (it != selected.end()) {
+                            m_seq[j++] = it->second;
+                            i += 1;
+                            continue;
+                        }
+                    }
+                    m_seq[j++] = m_seq[i];
+                }
+                m_seq.resize(j);
+            }
+        }
+
+        friend class repair_tail_vector;
+    };
+
+  private:
+    bool m_bin_mode = false;
+    compact_vector m_seq;
+    compact_vector m_rules;
+
+  public:
+    repair_tail_vector() = default;
+    virtual ~repair_tail_vector() = default;
+
+    repair_tail_vector(const repair_tail_vector&) = delete;
+    repair_tail_vector& operator=(const repair_tail_vector&) = delete;
+
+    repair_tail_vector(repair_tail_vector&&) noexcept = default;
+    repair_tail_vector& operator=(repair_tail_vector&&) noexcept = default;
+
+    explicit repair_tail_vector(builder&& b) : m_bin_mode(b.m_bin_mode), m_seq(b.m_seq) {
+        if (!b.m_rules.empty()) {
+            m_rules = compact_vector(b.m_rules);
+        }
+    }
+
+    inline bool bin_mode() const {
+        return m_bin_mode;
+    }
+
+    inline bool match(std::string_view key, std::uint64_t tpos) const {
+        std::uint64_t kpos = 0;
+        const bool terminated = scan(tpos, [&](char c) {
+            if (kpos == key.size() || key[kpos] != c) {
+                return false;
+            }
+            kpos += 1;
+            return true;
+        });
+        return terminated && kpos == key.size();
+    }
+
+    // Returns epos-tpos+1 if TAIL[tpos..epos] is a prefix of key.
+    inline std::optional<std::uint64_t> prefix_match(std::string_view key, std::uint64_t tpos) const {
+        std::uint64_t kpos = 0;
+        const bool terminated = scan(tpos, [&](char c) {
+            if (kpos == key.size() || key[kpos] != c) {
+                return false;
+            }
+            kpos += 1;
+            return true;
+        });
+        if (!terminated) {
+            return std::nullopt;
+        }
+        return kpos;
+    }
+
+    // Checks if key is a prefix of TAIL[tpos..epos].
+    inline bool predictive_match(std::string_view key, std::uint64_t tpos) const {
+        std::uint64_t kpos = 0;
+        bool mismatched = false;
+        scan(tpos, [&](char c) {
+            if (kpos == key.size()) {
+                return false;
+            }
+            if (key[kpos] != c) {
+                mismatched = true;
+                return false;
+            }
+            kpos += 1;
+            return true;
+        });
+        return !mismatched && kpos == key.size();
+    }
+
+    // Appends TAIL[tpos..epos] to decoded.
+    inline void decode(std::uint64_t tpos, std::string& decoded) const {
+        scan(tpos, [&](char c) {
+            decoded.push_back(c);
+            return true;
+        });
+    }
+
+    //! Get the number of symbols in the compressed sequence.
+    inline std::uint64_t size() const {
+        return m_seq.size();
+    }
+
+    //! Get the number of rules.
+    inline std::uint64_t num_rules() const {
+        return m_rules.size() / 2;
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_bin_mode);
+        visitor.visit(m_seq);
+        visitor.visit(m_rules);
+    }
+
+  private:
+    // Expands the symbols from tpos and calls fn(c) for each character c until fn returns false.
+    // Returns true if the terminator is reached.
+    template <class Fn>
+    inline bool scan(std::uint64_t tpos, Fn&& fn) const {
+        std::array<std::uint64_t, max_height> stack;
+        for (;; tpos++) {
+            std::uint64_t sym = m_seq[tpos];
+            if (sym == 0) {
+                return true;
+            }
+            std::uint64_t depth = 0;
+            while (true) {
+                if (sym <= 256) {
+                    if (!fn(static_cast<char>(sym - 1))) {
+                        return false;
+                    }
+                    if (depth == 0) {
+                        break;
+                    }
+                    sym = stack[--depth];
+                } else {
+                    const std::uint64_t r = (sym - 257) * 2;
+                    stack[depth++] = m_rules[r + 1];
+                    sym = m_rules[r];
+                }
+            }
+        }
+    }
+};
+
+}  // namespace xcdat
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "compact_vector.hpp"
+
+namespace xcdat {
+
+//! A compressed string dictionary with a companion trie of reversed keywords for suffix search.
+//! 'Trie' is the data type of the trie used for the operations other than suffix search.
+//! 'ReversedTrie' is the data type of the trie of reversed keywords, which must support the ID-only iterators.
+//!
+//! The keywords ending with a given string are the keywords whose reversals start with the reversed string,
+//! so suffix search is a predictive search on the reversed trie followed by the mapping from the IDs of
+//! the reversed trie to those of 'Trie'. The time is proportional to the number of results, not to the number
+//! of keywords. Note that the reversal splits multibyte characters, so 'ReversedTrie' should be byte-wise.
+template <class Trie, class ReversedTrie = Trie>
+class suffix_trie {
+  public:
+    using trie_type = Trie;
+    using reversed_trie_type = ReversedTrie;
+    using bc_vector_type = typename trie_type::bc_vector_type;
+    using tail_vector_type = typename trie_type::tail_vector_type;
+    using code_table_type = typename trie_type::code_table_type;
+
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = (6U << 24) | trie_type::type_id;
+
+  private:
+    trie_type m_trie;
+    reversed_trie_type m_rtrie;
+    compact_vector m_ids;  // the ID in m_trie of each ID in m_rtrie
+
+  public:
+    //! Default constructor
+    suffix_trie() = default;
+
+    //! Default destructor
+    virtual ~suffix_trie() = default;
+
+    //! Copy constructor (deleted)
+    suffix_trie(const suffix_trie&) = delete;
+
+    //! Copy constructor (deleted)
+    suffix_trie& operator=(const suffix_trie&) = delete;
+
+    //! Move constructor
+    suffix_trie(suffix_trie&&) noexcept = default;
+
+    //! Move constructor
+    suffix_trie& operator=(suffix_trie&&) noexcept = default;
+
+    //! Build the trie from the input keywords, which are lexicographically sorted and unique.
+    //! The arguments are the same as those of the constructor of 'Trie'.
+    template <class Strings>
+    suffix_trie(const Strings& keys, bool bin_mode = false) : m_trie(keys, bin_mode) {
+        std::vector<std::string> rkeys(keys.size());
+        for (std::uint64_t i = 0; i < keys.size(); i++) {
+            rkeys[i].assign(keys[i].rbegin(), keys[i].rend());
+        }
+        std::sort(rkeys.begin(), rkeys.end());
+        m_rtrie = reversed_trie_type(rkeys, bin_mode);
+
+        std::vector<std::uint64_t> ids(keys.size());
+        std::string key;
+        for (const auto& rkey : rkeys) {
+            key.assign(rkey.rbegin(), rkey.rend());
+            ids[m_rtrie.lookup(rkey).value()] = m_trie.lookup(key).value();
+        }
+        m_ids = compact_vector(ids);
+    }
+
+    //! Check if the binary mode.
+    inline bool bin_mode() const {
+        return m_trie.bin_mode();
+    }
+
+    //! Get the number of stored keywords.
+    inline std::uint64_t num_keys() const {
+        return m_trie.num_keys();
+    }
+
+    //! Get the alphabet size.
+    inline std::uint64_t alphabet_size() const {
+        return m_trie.alphabet_size();
+    }
+
+    //! Get the maximum length of keywords.
+    inline std::uint64_t max_length() const {
+        return m_trie.max_length();
+    }
+
+    //! Get the number of trie nodes.
+    inline std::uint64_t num_nodes() const {
+        return m_trie.num_nodes();
+    }
+
+    //! Get the number of DA units.
+    inline std::uint64_t num_units() const {
+        return m_trie.num_units();
+    }
+
+    //! Get the number of unused DA units.
+    inline std::uint64_t num_free_units() const {
+        return m_trie.num_free_units();
+    }
+
+    //! Get the length of TAIL vector.
+    inline std::uint64_t tail_length() const {
+        return m_trie.tail_length();
+    }
+
+    //! Get the underlying trie.
+    inline const trie_type& underlying_trie() const {
+        return m_trie;
+    }
+
+    //! Get the trie of reversed keywords.
+    inline const reversed_trie_type& reversed_trie() const {
+        return m_rtrie;
+    }
+
+    //! Lookup the ID of the keyword.
+    inline std::optional<std::uint64_t> lookup(std::string_view key) const {
+        return m_trie.lookup(key);
+    }
+
+    //! Decode the keyword associated with the ID.
+    inline std::string decode(std::uint64_t id) const {
+        return m_trie.decode(id);
+    }
+
+    //! Decode the keyword associated with the ID and store it in 'decoded'.
+    //! It can avoid reallocation of memory to store the result.
+    inline void decode(std::uint64_t id, std::string& decoded) const {
+        m_trie.decode(id, decoded);
+    }
+
+    //! An iterator class for common prefix search (see trie::prefix_iterator).
+    using prefix_iterator = typename trie_type::prefix_iterator;
+
+    //! Make the common prefix searcher for the given keyword.
+    inline prefix_iterator make_prefix_iterator(std::string_view key) const {
+        return m_trie.make_prefix_iterator(key);
+    }
+
+    //! Preform common prefix search for the keyword.
+    inline void prefix_search(std::string_view key,
+                              const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+        m_trie.prefix_search(key, fn);
+    }
+
+    //! An iterator class for predictive search (see trie::predictive_iterator).
+    using predictive_iterator = typename trie_type::predictive_iterator;
+
+    //! Make the predictive searcher for the keyword.
+    inline predictive_iterator make_predictive_iterator(std::string_view key) const {
+        return m_trie.make_predictive_iterator(key);
+    }
+
+    //! Make the predictive searcher resuming from the token of a searcher for the same keyword.
+    inline predictive_iterator make_predictive_iterator(std::string_view key, std::string_view token) const {
+        return m_trie.make_predictive_iterator(key, token);
+    }
+
+    //! Make the predictive searcher emitting only the IDs of the results.
+    inline predictive_iterator make_predictive_id_iterator(std::string_view key) const {
+        return m_trie.make_predictive_id_iterator(key);
+    }
+
+    //! Preform predictive search for the keyword.
+    inline void predictive_search(std::string_view key,
+                                  const std::function<void(std::uint64_t, std::string_view)>& fn,
+                                  std::uint64_t limit = UINT64_MAX) const {
+        m_trie.predictive_search(key, fn, limit);
+    }
+
+    //! Preform predictive search for the keyword, reporting only the IDs of the results.
+    inline void predictive_search_ids(std::string_view key, const std::function<void(std::uint64_t)>& fn,
+                                      std::uint64_t limit = UINT64_MAX) const {
+        m_trie.predictive_search_ids(key, fn, limit);
+    }
+
+    //! Preform suffix search for the keyword, i.e., enumerate the keywords ending with the given string.
+    //! The results are in the lexicographical order of the reversed keywords.
+    //! The search is terminated after 'limit' results.
+    inline void suffix_search(std::string_view key, const std::function<void(std::uint64_t, std::string_view)>& fn,
+                              std::uint64_t limit = UINT64_MAX) const {
+        const std::string rkey(key.rbegin(), key.rend());
+        std::string decoded;
+        auto itr = m_rtrie.make_predictive_iterator(rkey);
+        for (std::uint64_t i = 0; i < limit && itr.next(); i++) {
+            const std::string_view rdecoded = itr.decoded_view();
+            decoded.assign(rdecoded.rbegin(), rdecoded.rend());
+            fn(m_ids[itr.id()], decoded);
+        }
+    }
+
+    //! Preform suffix search for the keyword, reporting only the IDs of the results.
+    //! The search is terminated after 'limit' results.
+    inline void suffix_search_ids(std::string_view key, const std::function<void(std::uint64_t)>& fn,
+                                  std::uint64_t limit = UINT64_MAX) const {
+        const std::string rkey(key.rbegin(), key.rend());
+        auto itr = m_rtrie.make_predictive_id_iterator(rkey);
+        for (std::uint64_t i = 0; i < limit && itr.next(); i++) {
+            fn(m_ids[itr.id()]);
+        }
+    }
+
+    //! An iterator class for enumeration (see trie::enumerative_iterator).
+    using enumerative_iterator = typename trie_type::enumerative_iterator;
+
+    //! Make the enumerator.
+    inline enumerative_iterator make_enumerative_iterator() const {
+        return m_trie.make_enumerative_iterator();
+    }
+
+    //! Make the enumerator resuming from the token of an enumerator.
+    inline enumerative_iterator make_enumerative_iterator(std::string_view token) const {
+        return m_trie.make_enumerative_iterator(token);
+    }
+
+    //! Make the enumerator emitting only the IDs of the keywords.
+    inline enumerative_iterator make_enumerative_id_iterator() const {
+        return m_trie.make_enumerative_id_iterator();
+    }
+
+    //! Enumerate all the keywords and their IDs stored in the trie.
+    inline void enumerate(const std::function<void(std::uint64_t, std::string_view)>& fn,
+                          std::uint64_t limit = UINT64_MAX) const {
+        m_trie.enumerate(fn, limit);
+    }
+
+    //! Enumerate the IDs of all the keywords stored in the trie.
+    inline void enumerate_ids(const std::function<void(std::uint64_t)>& fn, std::uint64_t limit = UINT64_MAX) const {
+        m_trie.enumerate_ids(fn, limit);
+    }
+
+    //! Enumerate the keywords starting with the given string with worker threads (see trie::parallel_enumerate).
+    inline void parallel_enumerate(std::string_view key, std::uint64_t num_threads,
+                                   const std::function<void(std::uint64_t, std::string_view)>& sink,
+                                   bool ordered = true) const {
+        m_trie.parallel_enumerate(key, num_threads, sink, ordered);
+    }
+
+    //! Visit the members (commonly used for I/O).
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_trie);
+        visitor.visit(m_rtrie);
+        visitor.visit(m_ids);
+    }
+};
+
+}  // namespace xcdat
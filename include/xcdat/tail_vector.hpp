@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <optional>
 #include <string>
@@ -11,10 +12,20 @@
 #include "exception.hpp"
 #include "immutable_vector.hpp"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace xcdat {
 
 class tail_vector {
   public:
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = 0;
+
+    //! The number of bytes compared at once (the TAIL vector is padded with this number of bytes).
+    static constexpr std::uint64_t chunk_size = 16;
+
     struct suffix_type {
         std::string_view str;
         std::uint64_t npos;
@@ -111,6 +122,9 @@ class tail_vector {
 
                 prev_suffix = &curr_suffix;
             }
+
+            // Padding for safe over-reads in chunks
+            m_chars.resize(m_chars.size() + chunk_size, '\0');
         }
 
         friend class tail_vector;
@@ -140,31 +154,26 @@ class tail_vector {
         if (key.size() == 0) {
             return tpos == 0;
         }
+        if (bin_mode()) {
+            return length(tpos) == key.size() && std::memcmp(key.data(), m_chars.data() + tpos, key.size()) == 0;
+        }
 
+        // Compare key with the null-terminated suffix chunk by chunk.
+        const char* chars = m_chars.data() + tpos;
         std::uint64_t kpos = 0;
-
-        if (bin_mode()) {
-            do {
-                if (key[kpos] != m_chars[tpos]) {
-                    return false;
-                }
-                kpos += 1;
-                if (m_terms[tpos]) {
-                    return kpos == key.size();
-                }
-                tpos += 1;
-            } while (kpos < key.size());
-            return false;
-        } else {
-            do {
-                if (!m_chars[tpos] || key[kpos] != m_chars[tpos]) {
-                    return false;
-                }
-                kpos += 1;
-                tpos += 1;
-            } while (kpos < key.size());
-            return !m_chars[tpos];
+        for (; kpos + chunk_size <= key.size(); kpos += chunk_size) {
+            if (chunk_equals(chars + kpos, key.data() + kpos) != full_mask || chunk_zeros(chars + kpos) != 0) {
+                return false;
+            }
         }
+
+        // Compare the remaining bytes and the terminator.
+        const std::uint64_t rest = key.size() - kpos;
+        const std::uint64_t rest_mask = (1ULL << rest) - 1;
+        char buf[chunk_size] = {};
+        std::memcpy(buf, key.data() + kpos, rest);
+        return (chunk_equals(chars + kpos, buf) & (rest_mask << 1 | 1)) == (rest_mask << 1 | 1) &&
+               (chunk_zeros(chars + kpos) & rest_mask) == 0;
     }
 
     // Returns epos-tpos+1 if TAIL[tpos..epos] is a prefix of key.
@@ -173,51 +182,60 @@ class tail_vector {
             // suffix is empty, always matched.
             return 0;
         }
-        if (key.size() == 0) {
-            // When key is empty, match fails since the suffix is not empty here.
+        const std::uint64_t len = length(tpos);
+        if (key.size() < len || std::memcmp(key.data(), m_chars.data() + tpos, len) != 0) {
             return std::nullopt;
         }
+        return len;
+    }
 
-        std::uint64_t kpos = 0;
-        if (bin_mode()) {
-            do {
-                if (key[kpos] != m_chars[tpos]) {
-                    return std::nullopt;
-                }
-                kpos += 1;
-                if (m_terms[tpos]) {
-                    return kpos;
-                }
-                tpos += 1;
-            } while (kpos < key.size());
-            return kpos;
-        } else {
-            do {
-                if (!m_chars[tpos]) {
-                    return kpos;
-                }
-                if (key[kpos] != m_chars[tpos]) {
-                    return std::nullopt;
-                }
-                kpos += 1;
-                tpos += 1;
-            } while (kpos < key.size());
-            return kpos;
+    // Checks if key is a prefix of TAIL[tpos..epos].
+    inline bool predictive_match(std::string_view key, std::uint64_t tpos) const {
+        if (key.size() == 0) {
+            return true;
         }
+        if (tpos == 0) {
+            // When key is not empty, match fails since the suffix is empty here.
+            return false;
+        }
+        return key.size() <= length(tpos) && std::memcmp(key.data(), m_chars.data() + tpos, key.size()) == 0;
     }
 
-    inline void decode(std::uint64_t tpos, const std::function<void(char)>& fn) const {
-        if (bin_mode()) {
-            if (tpos != 0) {
-                do {
-                    fn(m_chars[tpos]);
-                } while (!m_terms[tpos++]);
-            }
-        } else {
-            while (m_chars[tpos]) {
-                fn(m_chars[tpos++]);
+    // Appends TAIL[tpos..epos] to decoded.
+    inline void decode(std::uint64_t tpos, std::string& decoded) const {
+        if (tpos != 0) {
+            decoded.append(m_chars.data() + tpos, length(tpos));
+        }
+    }
+
+    // Calls fn(c) for each character c of TAIL[tpos..epos] in reverse order until fn returns false.
+    // Returns true if all the characters are scanned.
+    template <class Fn>
+    inline bool reverse_scan(std::uint64_t tpos, Fn&& fn) const {
+        for (std::uint64_t i = length(tpos); i != 0; i--) {
+            if (!fn(m_chars[tpos + i - 1])) {
+                return false;
             }
         }
+        return true;
+    }
+
+    // Returns the length of TAIL[tpos..epos].
+    inline std::uint64_t length(std::uint64_t tpos) const {
+        if (tpos == 0) {
+            return 0;
+        }
+        if (bin_mode()) {
+            return m_terms.successor(tpos) - tpos + 1;
+        }
+        const char* chars = m_chars.data() + tpos;
+        std::uint64_t len = 0;
+        std::uint64_t zeros = chunk_zeros(chars);
+        while (zeros == 0) {
+            len += chunk_size;
+            zeros = chunk_zeros(chars + len);
+        }
+        return len + bit_tools::lsb(zeros);
     }
 
     inline std::uint64_t size() const {
@@ -229,6 +247,38 @@ class tail_vector {
         visitor.visit(m_chars);
         visitor.visit(m_terms);
     }
+
+  private:
+    static constexpr std::uint64_t full_mask = (1ULL << chunk_size) - 1;
+
+    // Returns the bit mask whose i-th bit indicates x[i] == y[i] for i in [0,chunk_size).
+    static inline std::uint64_t chunk_equals(const char* x, const char* y) {
+#ifdef __SSE2__
+        const __m128i vx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x));
+        const __m128i vy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y));
+        return static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vx, vy)));
+#else
+        std::uint64_t mask = 0;
+        for (std::uint64_t i = 0; i < chunk_size; i++) {
+            mask |= static_cast<std::uint64_t>(x[i] == y[i]) << i;
+        }
+        return mask;
+#endif
+    }
+
+    // Returns the bit mask whose i-th bit indicates x[i] == 0 for i in [0,chunk_size).
+    static inline std::uint64_t chunk_zeros(const char* x) {
+#ifdef __SSE2__
+        const __m128i vx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x));
+        return static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(vx, _mm_setzero_si128())));
+#else
+        std::uint64_t mask = 0;
+        for (std::uint64_t i = 0; i < chunk_size; i++) {
+            mask |= static_cast<std::uint64_t>(x[i] == '\0') << i;
+        }
+        return mask;
+#endif
+    }
 };
 
 }  // namespace xcdat
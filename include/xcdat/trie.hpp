@@ -1,31 +1,64 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "compact_vector.hpp"
 #include "trie_builder.hpp"
 
 namespace xcdat {
 
 //! A compressed string dictionary based on an improved double-array trie.
 //! 'BcVector' is the data type of Base and Check vectors.
-template <class BcVector>
+//! 'TailVector' is the data type of TAIL vector storing suffixes.
+//! 'CodeTable' is the data type of the code table defining transition labels.
+//! 'Capability' is the set of supported query operations (see trie_capability).
+template <class BcVector, class TailVector = tail_vector, class CodeTable = code_table,
+          trie_capability Capability = trie_capability::full>
 class trie {
   public:
-    using trie_type = trie<BcVector>;
+    using trie_type = trie<BcVector, TailVector, CodeTable, Capability>;
     using bc_vector_type = BcVector;
+    using tail_vector_type = TailVector;
+    using code_table_type = CodeTable;
 
     //! The type identifier.
-    static constexpr std::uint32_t type_id = bc_vector_type::l1_bits;
+    static constexpr std::uint32_t type_id = (static_cast<std::uint32_t>(Capability) << 28) |
+                                             (code_table_type::type_id << 16) | (tail_vector_type::type_id << 8) |
+                                             bc_vector_type::l1_bits;
+
+    //! The supported query operations.
+    static constexpr trie_capability capability = Capability;
+
+    //! The minimum number of keywords in a subtree whose number is stored (with trie_capability::counting).
+    //! The numbers of smaller subtrees are counted by traversing them.
+    static constexpr std::uint64_t count_sampling = 16;
 
   private:
     std::uint64_t m_num_keys = 0;
-    code_table m_table;
+    code_table_type m_table;
     bit_vector m_terms;
     bc_vector_type m_bcvec;
-    tail_vector m_tvec;
+    label_vector m_labels;
+    tail_vector_type m_tvec;
+    compact_vector m_nodes;  // node positions of IDs (only with trie_capability::fast_decode)
+    bit_vector m_sampled;  // nodes whose numbers of keywords are stored (only with trie_capability::counting)
+    compact_vector m_counts;  // numbers of keywords in the subtrees of the sampled nodes
+
+    static constexpr bool has_decode = Capability == trie_capability::full ||
+                                       Capability == trie_capability::fast_decode ||
+                                       Capability == trie_capability::counting;
+    static constexpr bool has_select =
+        Capability == trie_capability::full || Capability == trie_capability::counting;
 
   public:
     //! Default constructor
@@ -60,7 +93,8 @@ class trie {
     //!  - end() returns the iterator to the end.
     //! The type 'Strings::value_type::value_type' should be one-byte integer type such as 'char'.
     template <class Strings>
-    trie(const Strings& keys, bool bin_mode = false) : trie(trie_builder(keys, bc_vector_type::l1_bits, bin_mode)) {
+    trie(const Strings& keys, bool bin_mode = false)
+        : trie(trie_builder<Strings, tail_vector_type, code_table_type>(keys, bc_vector_type::l1_bits, bin_mode)) {
         static_assert(sizeof(char) == sizeof(typename Strings::value_type::value_type));
     }
 
@@ -105,30 +139,23 @@ class trie {
     }
 
     //! Lookup the ID of the keyword.
+    //! It is not supported with trie_capability::set.
     inline std::optional<std::uint64_t> lookup(std::string_view key) const {
-        std::uint64_t kpos = 0, npos = 0;
-        while (!m_bcvec.is_leaf(npos)) {
-            if (kpos == key.size()) {
-                if (!m_terms[npos]) {
-                    return std::nullopt;
-                }
-                return npos_to_id(npos);
-            }
-            const std::uint64_t cpos = m_bcvec.base(npos) ^ m_table.get_code(key[kpos++]);
-            if (m_bcvec.check(cpos) != npos) {
-                return std::nullopt;
-            }
-            npos = cpos;
-        }
-
-        const std::uint64_t tpos = m_bcvec.link(npos);
-        if (!m_tvec.match(get_suffix(key, kpos), tpos)) {
+        static_assert(Capability != trie_capability::set, "lookup is not supported by the set-only trie.");
+        const auto npos = find_node(key);
+        if (!npos.has_value()) {
             return std::nullopt;
         }
-        return npos_to_id(npos);
+        return npos_to_id(npos.value());
+    }
+
+    //! Check if the keyword is stored.
+    inline bool contains(std::string_view key) const {
+        return find_node(key).has_value();
     }
 
     //! Decode the keyword associated with the ID.
+    //! It is supported only with trie_capability::full and trie_capability::fast_decode.
     inline std::string decode(std::uint64_t id) const {
         std::string decoded;
         decoded.reserve(max_length());
@@ -139,6 +166,7 @@ class trie {
     //! Decode the keyword associated with the ID and store it in 'decoded'.
     //! It can avoid reallocation of memory to store the result.
     inline void decode(std::uint64_t id, std::string& decoded) const {
+        static_assert(has_decode, "decode is not supported by the capability.");
         decoded.clear();
 
         if (num_keys() <= id) {
@@ -146,18 +174,69 @@ class trie {
         }
 
         std::uint64_t npos = id_to_npos(id);
-        std::uint64_t tpos = m_bcvec.is_leaf(npos) ? m_bcvec.link(npos) : UINT64_MAX;
+        const std::uint64_t link = m_bcvec.is_leaf(npos) ? m_bcvec.link(npos) : 0;
 
-        while (npos != 0) {
+        // Append the characters from npos to the root in reverse order.
+        while (true) {
+            if (m_labels.has_label(npos)) {
+                m_labels.reverse_scan(npos, [&](char c) {
+                    decoded.push_back(c);
+                    return true;
+                });
+            }
+            if (npos == 0) {
+                break;
+            }
             const std::uint64_t ppos = m_bcvec.check(npos);
-            decoded.push_back(m_table.get_char(m_bcvec.base(ppos) ^ npos));
+            const std::string_view sym = m_table.get_symbol(m_bcvec.base(ppos) ^ npos);
+            decoded.append(sym.rbegin(), sym.rend());
             npos = ppos;
         }
 
         std::reverse(decoded.begin(), decoded.end());
-        if (tpos != 0 && tpos != UINT64_MAX) {
-            m_tvec.decode(tpos, [&](char c) { decoded.push_back(c); });
+        decode_tail(link, decoded);
+    }
+
+    //! Scan the keyword associated with the ID in reverse order, calling fn(c) for each character c
+    //! until fn returns false. Return true if all the characters are scanned.
+    //! It is used to match a suffix stored in a nested trie (see nested_tail_vector).
+    template <class Fn>
+    inline bool reverse_scan(std::uint64_t id, Fn&& fn) const {
+        static_assert(has_decode, "reverse_scan is not supported by the capability.");
+        std::uint64_t npos = id_to_npos(id);
+
+        if (m_bcvec.is_leaf(npos)) {
+            const std::uint64_t link = m_bcvec.link(npos);
+            if (inline_tail::is_inline(link)) {
+                if (!inline_tail::reverse_scan(link, fn)) {
+                    return false;
+                }
+            } else if (link != 0) {
+                if (!m_tvec.reverse_scan(inline_tail::to_tpos(link), fn)) {
+                    return false;
+                }
+            }
+        }
+
+        while (true) {
+            if (m_labels.has_label(npos)) {
+                if (!m_labels.reverse_scan(npos, fn)) {
+                    return false;
+                }
+            }
+            if (npos == 0) {
+                break;
+            }
+            const std::uint64_t ppos = m_bcvec.check(npos);
+            const std::string_view sym = m_table.get_symbol(m_bcvec.base(ppos) ^ npos);
+            for (auto it = sym.rbegin(); it != sym.rend(); ++it) {
+                if (!fn(*it)) {
+                    return false;
+                }
+            }
+            npos = ppos;
         }
+        return true;
     }
 
     //! An iterator class for common prefix search.
@@ -183,7 +262,9 @@ class trie {
         }
 
         //! Get the result ID.
+        //! It is not supported with trie_capability::set.
         inline std::uint64_t id() const {
+            static_assert(Capability != trie_capability::set, "IDs are not supported by the set-only trie.");
             return m_id;
         }
 
@@ -224,11 +305,14 @@ class trie {
     class predictive_iterator {
       public:
         struct cursor_type {
-            char label;
+            std::uint64_t code;
             std::uint64_t kpos;
             std::uint64_t npos;
         };
 
+        //! The code of a cursor without a transition label.
+        static constexpr std::uint64_t no_code = UINT64_MAX;
+
       private:
         const trie_type* m_obj = nullptr;
         std::string_view m_key;
@@ -237,6 +321,8 @@ class trie {
         std::vector<cursor_type> m_stack;
         bool is_beg = true;
         bool is_end = false;
+        bool is_lower_bound = false;
+        bool is_ids_only = false;
 
       public:
         predictive_iterator() = default;
@@ -248,11 +334,14 @@ class trie {
         }
 
         //! Get the result ID.
+        //! It is not supported with trie_capability::set.
         inline std::uint64_t id() const {
+            static_assert(Capability != trie_capability::set, "IDs are not supported by the set-only trie.");
             return m_id;
         }
 
         //! Get the result keyword.
+        //! It is not available with the iterators emitting only IDs.
         inline std::string decoded() const {
             return m_decoded;
         }
@@ -263,8 +352,33 @@ class trie {
             return m_decoded;
         }
 
+        //! Get the resume token, a byte string serializing the state of the iterator.
+        //! The iterator made from the token with the same keyword continues just after the current result,
+        //! in the same mode (e.g., emitting only IDs).
+        inline std::string token() const {
+            std::uint64_t prefix_length = 0;
+            for (const auto& cursor : m_stack) {
+                prefix_length = std::max(prefix_length, cursor.kpos);
+            }
+
+            std::string bytes;
+            bytes.push_back(static_cast<char>((is_beg ? 1 : 0) | (is_end ? 2 : 0) | (is_lower_bound ? 4 : 0) |
+                                              (is_ids_only ? 8 : 0)));
+            put_vbyte(bytes, prefix_length);
+            bytes.append(m_decoded, 0, prefix_length);
+            put_vbyte(bytes, m_stack.size());
+            for (const auto& cursor : m_stack) {
+                put_vbyte(bytes, cursor.code == no_code ? 0 : cursor.code + 1);
+                put_vbyte(bytes, cursor.kpos);
+                put_vbyte(bytes, cursor.npos);
+            }
+            return bytes;
+        }
+
       private:
-        predictive_iterator(const trie_type* obj, std::string_view key) : m_obj(obj), m_key(key) {}
+        predictive_iterator(const trie_type* obj, std::string_view key, bool lower_bound = false,
+                            bool ids_only = false)
+            : m_obj(obj), m_key(key), is_lower_bound(lower_bound), is_ids_only(ids_only) {}
 
         friend class trie;
     };
@@ -274,15 +388,116 @@ class trie {
         return predictive_iterator(this, key);
     }
 
+    //! Make the predictive searcher resuming from the token of a searcher for the same keyword.
+    //! Each page of results costs the time proportional to the page size, not to the skipped results.
+    inline predictive_iterator make_predictive_iterator(std::string_view key, std::string_view token) const {
+        predictive_iterator itr(this, key);
+        resume_predictive(&itr, token);
+        return itr;
+    }
+
+    //! Make the predictive searcher for the keyword, which emits only the IDs of the results.
+    //! It skips reconstructing the result keywords, so the function 'decoded' is not available.
+    //! It is not supported with trie_capability::set.
+    inline predictive_iterator make_predictive_id_iterator(std::string_view key) const {
+        static_assert(Capability != trie_capability::set, "IDs are not supported by the set-only trie.");
+        return predictive_iterator(this, key, false, true);
+    }
+
     //! Preform predictive search for the keyword.
+    //! The search is terminated after 'limit' results.
     inline void predictive_search(std::string_view key,
-                                  const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+                                  const std::function<void(std::uint64_t, std::string_view)>& fn,
+                                  std::uint64_t limit = UINT64_MAX) const {
         auto itr = make_predictive_iterator(key);
-        while (itr.next()) {
+        for (std::uint64_t i = 0; i < limit && itr.next(); i++) {
             fn(itr.id(), itr.decoded_view());
         }
     }
 
+    //! Preform predictive search for the keyword, reporting only the IDs of the results.
+    //! The search is terminated after 'limit' results.
+    inline void predictive_search_ids(std::string_view key, const std::function<void(std::uint64_t)>& fn,
+                                      std::uint64_t limit = UINT64_MAX) const {
+        auto itr = make_predictive_id_iterator(key);
+        for (std::uint64_t i = 0; i < limit && itr.next(); i++) {
+            fn(itr.id());
+        }
+    }
+
+    //! Count the keywords starting with the given string, without enumerating them.
+    //! It is supported only with trie_capability::counting.
+    inline std::uint64_t count_prefix(std::string_view key) const {
+        static_assert(Capability == trie_capability::counting, "count_prefix requires trie_capability::counting.");
+        auto itr = make_predictive_iterator(key);
+        itr.is_beg = false;
+        if (begin_predictive(&itr)) {
+            return 1;
+        }
+        std::uint64_t count = 0;
+        for (const auto& cursor : itr.m_stack) {
+            count += count_subtree(cursor.npos);
+        }
+        return count;
+    }
+
+    //! Count the keywords starting with the given string for each next character, i.e., the pairs (c, n) such
+    //! that n keywords start with key + c. The pairs are sorted by c as an unsigned byte.
+    //! It is supported only with trie_capability::counting.
+    inline std::vector<std::pair<char, std::uint64_t>> child_histogram(std::string_view key) const {
+        static_assert(Capability == trie_capability::counting, "child_histogram requires trie_capability::counting.");
+
+        std::array<std::uint64_t, 256> counts = {};
+        auto add_count = [&](char c, std::uint64_t n) { counts[static_cast<std::uint8_t>(c)] += n; };
+
+        auto itr = make_predictive_iterator(key);
+        itr.is_beg = false;
+        if (begin_predictive(&itr)) {
+            if (key.size() < itr.m_decoded.size()) {
+                add_count(itr.m_decoded[key.size()], 1);
+            }
+        } else {
+            std::string str;
+            for (const auto& cursor : itr.m_stack) {
+                // The string of the node
+                str.assign(itr.m_decoded, 0, cursor.kpos);
+                if (cursor.code != predictive_iterator::no_code) {
+                    str.append(m_table.get_symbol(cursor.code));
+                }
+                if (m_labels.has_label(cursor.npos)) {
+                    m_labels.decode(cursor.npos, str);
+                }
+
+                if (key.size() < str.size()) {
+                    add_count(str[key.size()], count_subtree(cursor.npos));
+                } else if (m_bcvec.is_leaf(cursor.npos)) {
+                    str.clear();
+                    decode_tail(m_bcvec.link(cursor.npos), str);
+                    if (!str.empty()) {
+                        add_count(str[0], 1);
+                    }
+                } else {
+                    const std::uint64_t base = m_bcvec.base(cursor.npos);
+                    for (std::uint64_t i = 0; i < m_table.alphabet_size(); i++) {
+                        const std::uint64_t code = m_table.nth_code(i);
+                        const std::uint64_t cpos = base ^ code;
+                        if (m_bcvec.check(cpos) == cursor.npos) {
+                            add_count(m_table.get_symbol(code)[0], count_subtree(cpos));
+                        }
+                    }
+                }
+            }
+        }
+
+        std::vector<std::pair<char, std::uint64_t>> histogram;
+        for (std::uint64_t c = 0; c < 256; c++) {
+            if (counts[c] != 0) {
+                histogram.emplace_back(static_cast<char>(c), counts[c]);
+            }
+        }
+        return histogram;
+    }
+
     //! An iterator class for enumeration.
     //! It enumerates all the keywords stored in the trie.
     //! It should be instantiated via the function 'make_enumerative_iterator'.
@@ -293,14 +508,127 @@ class trie {
         return enumerative_iterator(this, "");
     }
 
+    //! Make the enumerator resuming from the token of an enumerator (see predictive_iterator::token).
+    inline enumerative_iterator make_enumerative_iterator(std::string_view token) const {
+        return make_predictive_iterator("", token);
+    }
+
+    //! Make the enumerator starting from the smallest keyword not less than the given string.
+    //! It enumerates the keywords in the lexicographical order, as make_enumerative_iterator does.
+    inline enumerative_iterator make_lower_bound_iterator(std::string_view key) const {
+        return enumerative_iterator(this, key, true);
+    }
+
+    //! Make the enumerator emitting only the IDs of the keywords (see make_predictive_id_iterator).
+    inline enumerative_iterator make_enumerative_id_iterator() const {
+        return make_predictive_id_iterator("");
+    }
+
     //! Enumerate all the keywords and their IDs stored in the trie.
-    inline void enumerate(const std::function<void(std::uint64_t, std::string_view)>& fn) const {
+    //! The enumeration is terminated after 'limit' keywords.
+    inline void enumerate(const std::function<void(std::uint64_t, std::string_view)>& fn,
+                          std::uint64_t limit = UINT64_MAX) const {
         auto itr = make_enumerative_iterator();
-        while (itr.next()) {
+        for (std::uint64_t i = 0; i < limit && itr.next(); i++) {
             fn(itr.id(), itr.decoded_view());
         }
     }
 
+    //! Enumerate the IDs of all the keywords stored in the trie.
+    //! The enumeration is terminated after 'limit' keywords.
+    inline void enumerate_ids(const std::function<void(std::uint64_t)>& fn, std::uint64_t limit = UINT64_MAX) const {
+        auto itr = make_enumerative_id_iterator();
+        for (std::uint64_t i = 0; i < limit && itr.next(); i++) {
+            fn(itr.id());
+        }
+    }
+
+    //! Enumerate the keywords starting with the given string and their IDs with 'num_threads' worker threads.
+    //! The subtrees to be traversed are split into tasks of balanced sizes, which are exactly counted only with
+    //! trie_capability::counting. If 'ordered', 'sink' is called from the calling thread in the lexicographical
+    //! order, as predictive_search does. Otherwise, 'sink' is called concurrently from the worker threads.
+    //! It is not supported with trie_capability::set.
+    inline void parallel_enumerate(std::string_view key, std::uint64_t num_threads,
+                                   const std::function<void(std::uint64_t, std::string_view)>& sink,
+                                   bool ordered = true) const {
+        static_assert(Capability != trie_capability::set, "IDs are not supported by the set-only trie.");
+        XCDAT_THROW_IF(num_threads == 0, "The number of threads must be positive.");
+
+        auto itr = make_predictive_iterator(key);
+        itr.is_beg = false;
+        if (begin_predictive(&itr)) {
+            sink(itr.m_id, itr.m_decoded);
+            return;
+        }
+        if (itr.is_end) {
+            return;
+        }
+
+        const std::vector<enumeration_task> tasks = split_tasks(itr, num_threads * tasks_per_thread);
+        std::atomic<std::uint64_t> next_task(0);
+        std::vector<std::thread> workers;
+
+        if (!ordered) {
+            for (std::uint64_t t = 0; t < num_threads; t++) {
+                workers.emplace_back([&]() {
+                    for (std::uint64_t i = next_task++; i < tasks.size(); i = next_task++) {
+                        run_task(tasks[i], sink);
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            return;
+        }
+
+        // The results of each task are buffered, and emitted once the preceding tasks are emitted.
+        struct buffer_type {
+            std::vector<std::uint64_t> ids;
+            std::vector<std::uint64_t> ends;  // end positions of the keywords in 'strs'
+            std::string strs;
+            bool is_done = false;
+        };
+        std::vector<buffer_type> buffers(tasks.size());
+        std::mutex mtx;
+        std::condition_variable cv;
+
+        for (std::uint64_t t = 0; t < num_threads; t++) {
+            workers.emplace_back([&]() {
+                for (std::uint64_t i = next_task++; i < tasks.size(); i = next_task++) {
+                    buffer_type buffer;
+                    run_task(tasks[i], [&](std::uint64_t id, std::string_view str) {
+                        buffer.ids.push_back(id);
+                        buffer.strs.append(str);
+                        buffer.ends.push_back(buffer.strs.size());
+                    });
+                    {
+                        std::lock_guard<std::mutex> lock(mtx);
+                        buffers[i] = std::move(buffer);
+                        buffers[i].is_done = true;
+                    }
+                    cv.notify_all();
+                }
+            });
+        }
+
+        for (std::uint64_t i = 0; i < tasks.size(); i++) {
+            buffer_type buffer;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                cv.wait(lock, [&]() { return buffers[i].is_done; });
+                buffer = std::move(buffers[i]);
+            }
+            const std::string_view strs = buffer.strs;
+            for (std::uint64_t j = 0, beg = 0; j < buffer.ids.size(); beg = buffer.ends[j++]) {
+                sink(buffer.ids[j], strs.substr(beg, buffer.ends[j] - beg));
+            }
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
     //! Visit the members (commonly used for I/O).
     template <class Visitor>
     void visit(Visitor& visitor) {
@@ -308,26 +636,196 @@ class trie {
         visitor.visit(m_table);
         visitor.visit(m_terms);
         visitor.visit(m_bcvec);
+        visitor.visit(m_labels);
         visitor.visit(m_tvec);
+        if constexpr (Capability == trie_capability::fast_decode) {
+            visitor.visit(m_nodes);
+        }
+        if constexpr (Capability == trie_capability::counting) {
+            visitor.visit(m_sampled);
+            visitor.visit(m_counts);
+        }
     }
 
   private:
     template <class Strings>
-    explicit trie(trie_builder<Strings>&& b)
-        : m_num_keys(b.m_keys.size()), m_table(std::move(b.m_table)), m_terms(b.m_terms, true, true),
-          m_bcvec(b.m_units, std::move(b.m_leaves)), m_tvec(std::move(b.m_suffixes)) {}
+    explicit trie(trie_builder<Strings, tail_vector_type, code_table_type>&& b)
+        : m_num_keys(b.m_keys.size()), m_table(std::move(b.m_table)),
+          m_terms(b.m_terms, Capability != trie_capability::set, has_select),
+          m_bcvec(b.m_units, std::move(b.m_leaves)), m_labels(std::move(b.m_labels)),
+          m_tvec(std::move(b.m_suffixes)) {
+        if constexpr (Capability == trie_capability::fast_decode) {
+            std::vector<std::uint64_t> nodes;
+            nodes.reserve(m_num_keys);
+            for (std::uint64_t npos = 0; npos < m_terms.size(); npos++) {
+                if (m_terms[npos]) {
+                    nodes.push_back(npos);
+                }
+            }
+            m_nodes = compact_vector(nodes);
+        }
+        if constexpr (Capability == trie_capability::counting) {
+            build_counts();
+        }
+    }
+
+    // Samples the nodes whose subtrees have count_sampling or more keywords, and stores their numbers.
+    void build_counts() {
+        // Nodes in the depth-first order
+        std::vector<std::uint64_t> order;
+        order.reserve(num_nodes());
+        for (std::vector<std::uint64_t> stack = {0}; !stack.empty();) {
+            const std::uint64_t npos = stack.back();
+            stack.pop_back();
+            order.push_back(npos);
+            if (!m_bcvec.is_leaf(npos)) {
+                const std::uint64_t base = m_bcvec.base(npos);
+                for (std::uint64_t i = 0; i < m_table.alphabet_size(); i++) {
+                    const std::uint64_t cpos = base ^ m_table.nth_code(i);
+                    if (m_bcvec.check(cpos) == npos) {
+                        stack.push_back(cpos);
+                    }
+                }
+            }
+        }
+
+        // Accumulate the numbers from the bottom
+        std::vector<std::uint64_t> counts(num_units());
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            const std::uint64_t npos = *it;
+            counts[npos] += m_terms[npos] ? 1 : 0;
+            if (npos != 0) {
+                counts[m_bcvec.check(npos)] += counts[npos];
+            }
+        }
+
+        bit_vector::builder sampled(num_units());
+        std::vector<std::uint64_t> sampled_counts;
+        for (std::uint64_t npos = 0; npos < num_units(); npos++) {
+            if (count_sampling <= counts[npos] && !m_bcvec.is_leaf(npos)) {
+                sampled.set_bit(npos);
+                sampled_counts.push_back(counts[npos]);
+            }
+        }
+        // Dummy for the trie without sampled nodes, since compact_vector cannot be empty
+        if (sampled_counts.empty()) {
+            sampled_counts.push_back(0);
+        }
+        m_sampled = bit_vector(sampled, true);
+        m_counts = compact_vector(sampled_counts);
+    }
+
+    // Returns the number of keywords in the subtree of the node.
+    inline std::uint64_t count_subtree(std::uint64_t npos) const {
+        if (m_bcvec.is_leaf(npos)) {
+            return 1;
+        }
+        if (m_sampled[npos]) {
+            return m_counts[m_sampled.rank(npos)];
+        }
+        // The subtree has less than count_sampling keywords.
+        std::uint64_t count = m_terms[npos] ? 1 : 0;
+        const std::uint64_t base = m_bcvec.base(npos);
+        for (std::uint64_t i = 0; i < m_table.alphabet_size(); i++) {
+            const std::uint64_t cpos = base ^ m_table.nth_code(i);
+            if (m_bcvec.check(cpos) == npos) {
+                count += count_subtree(cpos);
+            }
+        }
+        return count;
+    }
+
+    // Returns the node position of the keyword if stored.
+    inline std::optional<std::uint64_t> find_node(std::string_view key) const {
+        std::uint64_t kpos = 0, npos = 0;
+        while (!m_bcvec.is_leaf(npos)) {
+            if (m_labels.has_label(npos)) {
+                const auto matched = m_labels.prefix_match(get_suffix(key, kpos), npos);
+                if (!matched.has_value()) {
+                    return std::nullopt;
+                }
+                kpos += matched.value();
+            }
+            if (kpos == key.size()) {
+                if (!m_terms[npos]) {
+                    return std::nullopt;
+                }
+                return npos;
+            }
+            const std::uint64_t cpos = m_bcvec.base(npos) ^ m_table.get_code(key, kpos);
+            if (m_bcvec.check(cpos) != npos) {
+                return std::nullopt;
+            }
+            npos = cpos;
+        }
+
+        if (!match_tail(get_suffix(key, kpos), m_bcvec.link(npos))) {
+            return std::nullopt;
+        }
+        return npos;
+    }
 
     static constexpr std::string_view get_suffix(std::string_view s, std::uint64_t i) {
         assert(i <= s.size());
         return s.substr(i, s.size() - i);
     }
 
+    inline bool match_tail(std::string_view suffix, std::uint64_t link) const {
+        if (inline_tail::is_inline(link)) {
+            return inline_tail::match(suffix, link);
+        }
+        return m_tvec.match(suffix, inline_tail::to_tpos(link));
+    }
+
+    inline std::optional<std::uint64_t> prefix_match_tail(std::string_view suffix, std::uint64_t link) const {
+        if (inline_tail::is_inline(link)) {
+            return inline_tail::prefix_match(suffix, link);
+        }
+        return m_tvec.prefix_match(suffix, inline_tail::to_tpos(link));
+    }
+
+    inline bool predictive_match_tail(std::string_view suffix, std::uint64_t link) const {
+        if (inline_tail::is_inline(link)) {
+            return inline_tail::predictive_match(suffix, link);
+        }
+        return m_tvec.predictive_match(suffix, inline_tail::to_tpos(link));
+    }
+
+    inline void decode_tail(std::uint64_t link, std::string& decoded) const {
+        if (inline_tail::is_inline(link)) {
+            inline_tail::decode(link, decoded);
+        } else if (link != 0) {
+            m_tvec.decode(inline_tail::to_tpos(link), decoded);
+        }
+    }
+
+    // Matches the label of the node with key[kpos..] and advances kpos if the node has a label.
+    inline bool match_label(std::string_view key, std::uint64_t& kpos, std::uint64_t npos) const {
+        if (!m_labels.has_label(npos)) {
+            return true;
+        }
+        const auto matched = m_labels.prefix_match(get_suffix(key, kpos), npos);
+        if (!matched.has_value()) {
+            return false;
+        }
+        kpos += matched.value();
+        return true;
+    }
+
     inline std::uint64_t npos_to_id(std::uint64_t npos) const {
-        return m_terms.rank(npos);
+        if constexpr (Capability == trie_capability::set) {
+            return 0;  // no rank structure
+        } else {
+            return m_terms.rank(npos);
+        }
     };
 
     inline std::uint64_t id_to_npos(std::uint64_t id) const {
-        return m_terms.select(id);
+        if constexpr (Capability == trie_capability::fast_decode) {
+            return m_nodes[id];
+        } else {
+            return m_terms.select(id);
+        }
     };
 
     inline bool next_prefix(prefix_iterator* itr) const {
@@ -337,7 +835,12 @@ class trie {
 
         if (itr->is_beg) {
             itr->is_beg = false;
-            if (m_terms[itr->m_npos]) {
+            if (!match_label(itr->m_key, itr->m_kpos, itr->m_npos)) {
+                itr->is_end = true;
+                itr->m_id = num_keys();
+                return false;
+            }
+            if (!m_bcvec.is_leaf(itr->m_npos) && m_terms[itr->m_npos]) {
                 itr->m_id = npos_to_id(itr->m_npos);
                 return true;
             }
@@ -358,7 +861,7 @@ class trie {
                 return false;
             }
 
-            const std::uint64_t cpos = m_bcvec.base(itr->m_npos) ^ m_table.get_code(itr->m_key[itr->m_kpos++]);
+            const std::uint64_t cpos = m_bcvec.base(itr->m_npos) ^ m_table.get_code(itr->m_key, itr->m_kpos);
 
             if (m_bcvec.check(cpos) != itr->m_npos) {
                 itr->is_end = true;
@@ -367,6 +870,11 @@ class trie {
             }
 
             itr->m_npos = cpos;
+            if (!match_label(itr->m_key, itr->m_kpos, itr->m_npos)) {
+                itr->is_end = true;
+                itr->m_id = num_keys();
+                return false;
+            }
             if (!m_bcvec.is_leaf(itr->m_npos) && m_terms[itr->m_npos]) {
                 itr->m_id = npos_to_id(itr->m_npos);
                 return true;
@@ -374,8 +882,7 @@ class trie {
         }
         itr->is_end = true;
 
-        const std::uint64_t tpos = m_bcvec.link(itr->m_npos);
-        const auto matched = m_tvec.prefix_match(get_suffix(itr->m_key, itr->m_kpos), tpos);
+        const auto matched = prefix_match_tail(get_suffix(itr->m_key, itr->m_kpos), m_bcvec.link(itr->m_npos));
         if (!matched.has_value()) {
             itr->m_id = num_keys();
             return false;
@@ -385,73 +892,349 @@ class trie {
         return true;
     }
 
-    inline bool next_predictive(predictive_iterator* itr) const {
-        if (itr->is_end) {
-            return false;
+    // Pushes the cursors of the subtrees whose keywords are not less than the key of the iterator,
+    // so that the cursor of the smallest keywords is on the top.
+    inline void seek_lower_bound(predictive_iterator* itr) const {
+        const std::string_view key = itr->m_key;
+        std::string str;
+
+        std::uint64_t kpos = 0;
+        std::uint64_t npos = 0;
+
+        while (true) {
+            const std::uint64_t lpos = itr->m_decoded.size();  // without the label of npos
+
+            if (m_labels.has_label(npos)) {
+                str.clear();
+                m_labels.decode(npos, str);
+                const std::string_view rest = get_suffix(key, kpos);
+                if (rest.substr(0, str.size()) != str) {
+                    if (rest.compare(str) < 0) {
+                        itr->m_stack.push_back({predictive_iterator::no_code, lpos, npos});
+                    }
+                    return;
+                }
+                itr->m_decoded.append(str);
+                kpos += str.size();
+            }
+
+            const std::string_view rest = get_suffix(key, kpos);
+            if (rest.size() == 0) {
+                itr->m_stack.push_back({predictive_iterator::no_code, lpos, npos});
+                return;
+            }
+
+            if (m_bcvec.is_leaf(npos)) {
+                str.clear();
+                decode_tail(m_bcvec.link(npos), str);
+                if (rest.compare(str) <= 0) {
+                    itr->m_stack.push_back({predictive_iterator::no_code, lpos, npos});
+                }
+                return;
+            }
+
+            // Push the children with larger symbols, and find the child to be followed.
+            const std::uint64_t base = m_bcvec.base(npos);
+            std::optional<std::uint64_t> next_code;
+            for (std::uint64_t i = m_table.alphabet_size(); i > 0; --i) {
+                const std::uint64_t code = m_table.nth_code(i - 1);
+                const std::uint64_t cpos = base ^ code;
+                if (m_bcvec.check(cpos) != npos) {
+                    continue;
+                }
+                const std::string_view sym = m_table.get_symbol(code);
+                const int cmp = rest.substr(0, sym.size()).compare(sym);
+                if (cmp < 0) {
+                    itr->m_stack.push_back({code, itr->m_decoded.size(), cpos});
+                    continue;
+                }
+                if (cmp == 0) {
+                    next_code = code;
+                }
+                break;
+            }
+            if (!next_code.has_value()) {
+                return;
+            }
+
+            const std::string_view sym = m_table.get_symbol(next_code.value());
+            itr->m_decoded.append(sym);
+            kpos += sym.size();
+            npos = base ^ next_code.value();
         }
+    }
 
-        if (itr->is_beg) {
-            itr->is_beg = false;
+    // The number of tasks per worker thread in parallel_enumerate, with which a slow task is compensated.
+    static constexpr std::uint64_t tasks_per_thread = 16;
+
+    // A subtree traversed by a worker thread in parallel_enumerate, or a single keyword at an internal node.
+    struct enumeration_task {
+        std::string str;  // the keyword of the parent (or of the node itself if is_single)
+        typename predictive_iterator::cursor_type cursor;
+        bool is_single;
+    };
 
-            std::uint64_t kpos = 0;
-            std::uint64_t npos = 0;
+    // Splits the subtrees of the cursors into at least 'num_tasks' tasks if possible, by replacing the largest
+    // subtree with the keyword at its root and the subtrees of its children. The tasks keep the lexicographical
+    // order. The sizes are estimated by count_subtree with trie_capability::counting, or by the depths otherwise.
+    inline std::vector<enumeration_task> split_tasks(const predictive_iterator& itr, std::uint64_t num_tasks) const {
+        std::vector<enumeration_task> tasks;
+        for (auto it = itr.m_stack.rbegin(); it != itr.m_stack.rend(); ++it) {
+            tasks.push_back({itr.m_decoded.substr(0, it->kpos), *it, false});
+        }
 
-            for (; kpos < itr->m_key.size(); ++kpos) {
-                if (m_bcvec.is_leaf(npos)) {
-                    itr->is_end = true;
-                    const std::uint64_t tpos = m_bcvec.link(npos);
-                    if (tpos == 0) {
-                        return false;
-                    }
-                    if (!m_tvec.prefix_match(get_suffix(itr->m_key, kpos), tpos)) {
-                        return false;
-                    }
-                    itr->m_id = npos_to_id(npos);
-                    m_tvec.decode(tpos, [&](char c) { itr->m_decoded.push_back(c); });
-                    return true;
+        auto estimate = [&](const enumeration_task& task) -> std::uint64_t {
+            if constexpr (Capability == trie_capability::counting) {
+                return count_subtree(task.cursor.npos);
+            } else {
+                return UINT64_MAX - task.str.size();
+            }
+        };
+
+        while (tasks.size() < num_tasks) {
+            std::optional<std::uint64_t> target;
+            std::uint64_t max_size = 0;
+            for (std::uint64_t i = 0; i < tasks.size(); i++) {
+                if (tasks[i].is_single || m_bcvec.is_leaf(tasks[i].cursor.npos)) {
+                    continue;
+                }
+                const std::uint64_t size = estimate(tasks[i]);
+                if (!target.has_value() || max_size < size) {
+                    target = i;
+                    max_size = size;
                 }
+            }
+            if (!target.has_value()) {
+                break;
+            }
 
-                const std::uint64_t cpos = m_bcvec.base(npos) ^ m_table.get_code(itr->m_key[kpos]);
-                if (m_bcvec.check(cpos) != npos) {
+            const auto cursor = tasks[target.value()].cursor;
+            std::string str = tasks[target.value()].str;
+            if (cursor.code != predictive_iterator::no_code) {
+                str.append(m_table.get_symbol(cursor.code));
+            }
+            if (m_labels.has_label(cursor.npos)) {
+                m_labels.decode(cursor.npos, str);
+            }
+
+            std::vector<enumeration_task> children;
+            if (m_terms[cursor.npos]) {
+                children.push_back({str, {predictive_iterator::no_code, str.size(), cursor.npos}, true});
+            }
+            const std::uint64_t base = m_bcvec.base(cursor.npos);
+            for (std::uint64_t i = 0; i < m_table.alphabet_size(); i++) {
+                const std::uint64_t code = m_table.nth_code(i);
+                const std::uint64_t cpos = base ^ code;
+                if (m_bcvec.check(cpos) == cursor.npos) {
+                    children.push_back({str, {code, str.size(), cpos}, false});
+                }
+            }
+
+            tasks.erase(tasks.begin() + target.value());
+            tasks.insert(tasks.begin() + target.value(), children.begin(), children.end());
+        }
+        return tasks;
+    }
+
+    template <class Sink>
+    inline void run_task(const enumeration_task& task, Sink&& sink) const {
+        if (task.is_single) {
+            sink(npos_to_id(task.cursor.npos), task.str);
+            return;
+        }
+        predictive_iterator itr(this, "");
+        itr.is_beg = false;
+        itr.m_decoded = task.str;
+        itr.m_stack.push_back(task.cursor);
+        while (next_predictive(&itr)) {
+            sink(itr.m_id, itr.m_decoded);
+        }
+    }
+
+    static void put_vbyte(std::string& bytes, std::uint64_t x) {
+        while (128 <= x) {
+            bytes.push_back(static_cast<char>((x & 127) | 128));
+            x >>= 7;
+        }
+        bytes.push_back(static_cast<char>(x));
+    }
+
+    static std::uint64_t get_vbyte(std::string_view& bytes) {
+        std::uint64_t x = 0;
+        for (std::uint64_t shift = 0; shift < 64; shift += 7) {
+            XCDAT_THROW_IF(bytes.empty(), "The resume token is truncated.");
+            const auto c = static_cast<std::uint8_t>(bytes[0]);
+            bytes.remove_prefix(1);
+            x |= static_cast<std::uint64_t>(c & 127) << shift;
+            if (c < 128) {
+                return x;
+            }
+        }
+        XCDAT_THROW("The resume token is broken.");
+    }
+
+    // Restores the state of the predictive iterator from the token. The cursors are verified against the trie,
+    // so a token of another dictionary is rejected unless it happens to be consistent.
+    inline void resume_predictive(predictive_iterator* itr, std::string_view token) const {
+        XCDAT_THROW_IF(token.empty(), "The resume token is empty.");
+        const auto flags = static_cast<std::uint8_t>(token[0]);
+        token.remove_prefix(1);
+
+        itr->is_beg = (flags & 1) != 0;
+        itr->is_end = (flags & 2) != 0;
+        itr->is_lower_bound = (flags & 4) != 0;
+        itr->is_ids_only = (flags & 8) != 0;
+        XCDAT_THROW_IF(itr->is_ids_only && Capability == trie_capability::set, "The resume token is broken.");
+
+        const std::uint64_t prefix_length = get_vbyte(token);
+        XCDAT_THROW_IF(token.size() < prefix_length, "The resume token is truncated.");
+        itr->m_decoded.assign(token.substr(0, prefix_length));
+        token.remove_prefix(prefix_length);
+
+        const std::uint64_t num_cursors = get_vbyte(token);
+        XCDAT_THROW_IF(token.size() < num_cursors * 3, "The resume token is truncated.");
+        itr->m_stack.resize(num_cursors);
+
+        for (auto& cursor : itr->m_stack) {
+            const std::uint64_t code = get_vbyte(token);
+            cursor.code = code == 0 ? predictive_iterator::no_code : code - 1;
+            cursor.kpos = get_vbyte(token);
+            cursor.npos = get_vbyte(token);
+
+            XCDAT_THROW_IF(prefix_length < cursor.kpos, "The resume token is broken.");
+            XCDAT_THROW_IF(num_units() <= cursor.npos, "The resume token is broken.");
+            if (cursor.code != predictive_iterator::no_code) {
+                // The code must be the transition label from the parent.
+                XCDAT_THROW_IF(cursor.npos == 0, "The resume token is broken.");
+                const std::uint64_t ppos = m_bcvec.check(cursor.npos);
+                XCDAT_THROW_IF(num_units() <= ppos || m_bcvec.is_leaf(ppos), "The resume token is broken.");
+                XCDAT_THROW_IF((m_bcvec.base(ppos) ^ cursor.code) != cursor.npos, "The resume token is broken.");
+            }
+        }
+        XCDAT_THROW_IF(!token.empty(), "The resume token is broken.");
+    }
+
+    // Walks down the trie along the key of the predictive iterator, and pushes the cursors of the subtrees
+    // whose keywords start with the key. Returns true if the only result is found at a leaf.
+    inline bool begin_predictive(predictive_iterator* itr) const {
+        std::uint64_t kpos = 0;
+        std::uint64_t npos = 0;
+        bool is_partial = false;
+
+        while (kpos < itr->m_key.size()) {
+            if (m_bcvec.is_leaf(npos)) {
+                itr->is_end = true;
+                const std::uint64_t link = m_bcvec.link(npos);
+                if (!predictive_match_tail(get_suffix(itr->m_key, kpos), link)) {
+                    return false;
+                }
+                itr->m_id = npos_to_id(npos);
+                if (!itr->is_ids_only) {
+                    decode_tail(link, itr->m_decoded);
+                }
+                return true;
+            }
+
+            if (m_labels.has_label(npos)) {
+                const std::string_view rest = get_suffix(itr->m_key, kpos);
+                if (m_labels.predictive_match(rest, npos)) {
+                    break;  // The key ends within the label.
+                }
+                const auto matched = m_labels.prefix_match(rest, npos);
+                if (!matched.has_value()) {
                     itr->is_end = true;
                     return false;
                 }
+                m_labels.decode(npos, itr->m_decoded);
+                kpos += matched.value();
+            }
 
-                npos = cpos;
-                itr->m_decoded.push_back(itr->m_key[kpos]);
+            if (m_table.is_partial(itr->m_key, kpos)) {
+                // The key ends within a symbol, so enumerate the children whose symbols start with the rest.
+                const std::string_view rest = get_suffix(itr->m_key, kpos);
+                const std::uint64_t base = m_bcvec.base(npos);
+                for (std::uint64_t i = m_table.alphabet_size(); i > 0; --i) {
+                    const std::uint64_t code = m_table.nth_code(i - 1);
+                    const std::uint64_t cpos = base ^ code;
+                    if (m_bcvec.check(cpos) == npos && m_table.get_symbol(code).substr(0, rest.size()) == rest) {
+                        itr->m_stack.push_back({code, itr->m_decoded.size(), cpos});
+                    }
+                }
+                is_partial = true;
+                break;
             }
 
-            if (!itr->m_decoded.empty()) {
-                itr->m_stack.push_back({itr->m_decoded.back(), kpos, npos});
-            } else {
-                itr->m_stack.push_back({'\0', kpos, npos});
+            const std::uint64_t code = m_table.get_code(itr->m_key, kpos);
+            const std::uint64_t cpos = m_bcvec.base(npos) ^ code;
+            if (m_bcvec.check(cpos) != npos) {
+                itr->is_end = true;
+                return false;
+            }
+
+            npos = cpos;
+            itr->m_decoded.append(m_table.get_symbol(code));
+        }
+
+        // The label of npos is appended when the cursor is popped.
+        if (!is_partial) {
+            itr->m_stack.push_back({predictive_iterator::no_code, itr->m_decoded.size(), npos});
+        }
+        return false;
+    }
+
+    inline bool next_predictive(predictive_iterator* itr) const {
+        if (itr->is_end) {
+            return false;
+        }
+
+        if (itr->is_beg && itr->is_lower_bound) {
+            itr->is_beg = false;
+            seek_lower_bound(itr);
+        }
+
+        if (itr->is_beg) {
+            itr->is_beg = false;
+            if (begin_predictive(itr)) {
+                return true;
+            }
+            if (itr->is_end) {
+                return false;
             }
         }
 
         while (!itr->m_stack.empty()) {
-            const char label = itr->m_stack.back().label;
+            const std::uint64_t code = itr->m_stack.back().code;
             const std::uint64_t kpos = itr->m_stack.back().kpos;
             const std::uint64_t npos = itr->m_stack.back().npos;
 
             itr->m_stack.pop_back();
 
-            if (0 < kpos) {
+            if (!itr->is_ids_only) {
                 itr->m_decoded.resize(kpos);
-                itr->m_decoded.back() = label;
+                if (code != predictive_iterator::no_code) {
+                    itr->m_decoded.append(m_table.get_symbol(code));
+                }
+                if (m_labels.has_label(npos)) {
+                    m_labels.decode(npos, itr->m_decoded);
+                }
             }
 
             if (m_bcvec.is_leaf(npos)) {
                 itr->m_id = npos_to_id(npos);
-                m_tvec.decode(m_bcvec.link(npos), [&](char c) { itr->m_decoded.push_back(c); });
+                if (!itr->is_ids_only) {
+                    decode_tail(m_bcvec.link(npos), itr->m_decoded);
+                }
                 return true;
             }
 
             const std::uint64_t base = m_bcvec.base(npos);
+            const std::uint64_t next_kpos = itr->m_decoded.size();
 
-            for (auto cit = m_table.rbegin(); cit != m_table.rend(); ++cit) {
-                const std::uint64_t cpos = base ^ m_table.get_code(*cit);
+            for (std::uint64_t i = m_table.alphabet_size(); i > 0; --i) {
+                const std::uint64_t child_code = m_table.nth_code(i - 1);
+                const std::uint64_t cpos = base ^ child_code;
                 if (m_bcvec.check(cpos) == npos) {
-                    itr->m_stack.push_back({static_cast<char>(*cit), kpos + 1, cpos});
+                    itr->m_stack.push_back({child_code, next_kpos, cpos});
                 }
             }
 
@@ -7,13 +7,16 @@
 // #include "bc_vector.hpp"
 #include "code_table.hpp"
 #include "exception.hpp"
+#include "inline_tail.hpp"
+#include "label_vector.hpp"
 #include "tail_vector.hpp"
+#include "trie_capability.hpp"
 
 namespace xcdat {
 
-template <class Strings>
+template <class Strings, class TailVector, class CodeTable>
 class trie_builder {
-    template <class>
+    template <class, class, class, trie_capability>
     friend class trie;
 
   public:
@@ -32,20 +35,27 @@ class trie_builder {
 
     bool m_bin_mode = false;
 
-    code_table m_table;
+    CodeTable m_table;
+    std::uint64_t m_block_size = 0;
     std::vector<unit_type> m_units;
     bit_vector::builder m_leaves;
     bit_vector::builder m_terms;
     bit_vector::builder m_useds;
     std::vector<std::uint64_t> m_heads;  // for L1 blocks
-    std::vector<std::uint8_t> m_edges;
-    tail_vector::builder m_suffixes;
+    std::vector<std::uint64_t> m_edges;
+    label_vector::builder m_labels;
+    typename TailVector::builder m_suffixes;
 
   public:
     explicit trie_builder(const Strings& keys, std::uint32_t l1_bits, bool bin_mode)
         : m_keys(keys), m_l1_bits(std::min(l1_bits, 8U)), m_l1_size(1ULL << m_l1_bits), m_bin_mode(bin_mode) {
         XCDAT_THROW_IF(m_keys.size() == 0, "The input dataset is empty.");
 
+        // Build the code table
+        m_table = CodeTable(keys);
+        m_bin_mode |= m_table.has_null();
+        m_block_size = m_table.block_size();
+
         // Reserve
         {
             std::uint64_t init_capa = 1;
@@ -61,16 +71,16 @@ class trie_builder {
         }
 
         // Initialize an empty list.
-        for (std::uint64_t npos = 0; npos < 256; ++npos) {
+        for (std::uint64_t npos = 0; npos < m_block_size; ++npos) {
             m_units.push_back(unit_type{npos + 1, npos - 1});
             m_leaves.push_back(false);
             m_terms.push_back(false);
             m_useds.push_back(false);
         }
-        m_units[255].base = 0;
-        m_units[0].check = 255;
+        m_units[m_block_size - 1].base = 0;
+        m_units[0].check = m_block_size - 1;
 
-        for (std::uint64_t npos = 0; npos < 256; npos += m_l1_size) {
+        for (std::uint64_t npos = 0; npos < m_block_size; npos += m_l1_size) {
             m_heads.push_back(npos);
         }
 
@@ -80,18 +90,19 @@ class trie_builder {
         m_useds.set_bit(taboo_npos, true);
         m_heads[taboo_npos >> m_l1_bits] = m_units[taboo_npos].base;
 
-        // Build the code table
-        m_table = code_table(keys);
-        m_bin_mode |= m_table.has_null();
-
         // Build the BC units
         arrange(0, m_keys.size(), 0, 0);
 
         // Finish
         finish();
 
+        // Build the labels of unary chains
+        m_labels.complete(m_units.size(), m_bin_mode);
+
         // Build the TAIL vector
-        m_suffixes.complete(m_bin_mode, [&](std::uint64_t npos, std::uint64_t tpos) { m_units[npos].base = tpos; });
+        m_suffixes.complete(m_bin_mode, [&](std::uint64_t npos, std::uint64_t tpos) {
+            m_units[npos].base = inline_tail::to_link(tpos);
+        });
     }
 
     virtual ~trie_builder() = default;
@@ -118,8 +129,8 @@ class trie_builder {
     }
 
     inline void close_block(std::uint64_t bpos) {
-        const auto beg_npos = bpos * 256;
-        const auto end_npos = beg_npos + 256;
+        const auto beg_npos = bpos * m_block_size;
+        const auto end_npos = beg_npos + m_block_size;
 
         for (auto npos = beg_npos; npos < end_npos; ++npos) {
             if (!m_useds[npos]) {
@@ -137,7 +148,7 @@ class trie_builder {
 
     void expand() {
         const auto old_size = static_cast<std::uint64_t>(m_units.size());
-        const auto new_size = old_size + 256;
+        const auto new_size = old_size + m_block_size;
 
         for (auto npos = old_size; npos < new_size; ++npos) {
             m_units.push_back({npos + 1, npos - 1});
@@ -158,7 +169,7 @@ class trie_builder {
             m_heads.push_back(npos);
         }
 
-        const auto bpos = old_size / 256;
+        const auto bpos = old_size / m_block_size;
         if (free_blocks <= bpos) {
             close_block(bpos - free_blocks);
         }
@@ -166,7 +177,7 @@ class trie_builder {
 
     void finish() {
         while (m_units[taboo_npos].base != taboo_npos) {
-            auto bpos = m_units[taboo_npos].base / 256;
+            auto bpos = m_units[taboo_npos].base / m_block_size;
             close_block(bpos);
         }
     }
@@ -183,23 +194,40 @@ class trie_builder {
             XCDAT_THROW_IF(m_keys[beg].size() <= kpos, "The input keys are not unique.");
             m_terms.set_bit(npos, true);
             m_leaves.set_bit(npos, true);
-            m_suffixes.set_suffix({m_keys[beg].data() + kpos, m_keys[beg].size() - kpos}, npos);
+            const std::string_view suffix{m_keys[beg].data() + kpos, m_keys[beg].size() - kpos};
+            if (suffix.size() <= inline_tail::max_length) {
+                m_units[npos].base = inline_tail::encode(suffix);  // without TAIL
+            } else {
+                m_suffixes.set_suffix(suffix, npos);
+            }
             return;
+        } else {
+            // compressing a unary chain
+            const std::uint64_t len = snap_to_symbol(beg, kpos, common_prefix_length(beg, end, kpos));
+            if (label_vector::min_length <= len) {
+                m_labels.set_label({m_keys[beg].data() + kpos, len}, npos);
+                kpos += len;
+                if (m_keys[beg].size() == kpos) {
+                    m_terms.set_bit(npos, true);
+                    ++beg;
+                }
+            }
         }
 
         // fetching edges
         {
+            XCDAT_THROW_IF(m_keys[beg].size() <= kpos, "The input keys are not unique.");
             m_edges.clear();
-            auto ch = static_cast<std::uint8_t>(m_keys[beg][kpos]);
+            auto sym = get_symbol(beg, kpos);
             for (auto i = beg + 1; i < end; ++i) {
-                const auto next_ch = static_cast<std::uint8_t>(m_keys[i][kpos]);
-                if (ch != next_ch) {
-                    XCDAT_THROW_IF(next_ch < ch, "The input keys are not in lexicographical order.");
-                    m_edges.push_back(ch);
-                    ch = next_ch;
+                const auto next_sym = get_symbol(i, kpos);
+                if (sym != next_sym) {
+                    XCDAT_THROW_IF(next_sym < sym, "The input keys are not in lexicographical order.");
+                    m_edges.push_back(get_code(sym));
+                    sym = next_sym;
                 }
             }
-            m_edges.push_back(ch);
+            m_edges.push_back(get_code(sym));
         }
 
         const auto base = xcheck(npos >> m_l1_bits);
@@ -209,34 +237,75 @@ class trie_builder {
 
         // defining new edges
         m_units[npos].base = base;
-        for (const auto ch : m_edges) {
-            const auto child_id = base ^ m_table.get_code(ch);
+        for (const auto code : m_edges) {
+            const auto child_id = base ^ code;
             use_unit(child_id);
             m_units[child_id].check = npos;
         }
 
         // following the children
         auto i = beg;
-        auto ch = static_cast<std::uint8_t>(m_keys[beg][kpos]);
+        auto sym = get_symbol(beg, kpos);
         for (auto j = beg + 1; j < end; ++j) {
-            const auto next_ch = static_cast<std::uint8_t>(m_keys[j][kpos]);
-            if (ch != next_ch) {
-                arrange(i, j, kpos + 1, base ^ m_table.get_code(ch));
-                ch = next_ch;
+            const auto next_sym = get_symbol(j, kpos);
+            if (sym != next_sym) {
+                arrange(i, j, kpos + sym.size(), base ^ get_code(sym));
+                sym = next_sym;
                 i = j;
             }
         }
-        arrange(i, end, kpos + 1, base ^ m_table.get_code(ch));
+        arrange(i, end, kpos + sym.size(), base ^ get_code(sym));
+    }
+
+    // Returns the symbol (i.e., the transition label) at keys[i][kpos].
+    inline std::string_view get_symbol(std::uint64_t i, std::uint64_t kpos) const {
+        const std::string_view key{m_keys[i].data(), m_keys[i].size()};
+        return key.substr(kpos, m_table.symbol_length(key, kpos));
+    }
+
+    inline std::uint64_t get_code(std::string_view sym) const {
+        std::uint64_t kpos = 0;
+        return m_table.get_code(sym, kpos);
+    }
+
+    // Shortens the length of a label starting at keys[beg][kpos] so that it ends at a symbol boundary.
+    inline std::uint64_t snap_to_symbol(std::uint64_t beg, std::uint64_t kpos, std::uint64_t len) const {
+        if constexpr (CodeTable::max_symbol_length == 1) {
+            return len;
+        } else {
+            const std::string_view key{m_keys[beg].data(), m_keys[beg].size()};
+            std::uint64_t snapped = 0;
+            while (snapped < len) {
+                const std::uint64_t sym_len = m_table.symbol_length(key, kpos + snapped);
+                if (len < snapped + sym_len) {
+                    break;
+                }
+                snapped += sym_len;
+            }
+            return snapped;
+        }
+    }
+
+    // Returns the length of the longest common prefix of keys[beg..end) after kpos.
+    inline std::uint64_t common_prefix_length(std::uint64_t beg, std::uint64_t end, std::uint64_t kpos) const {
+        const auto& first = m_keys[beg];
+        const auto& last = m_keys[end - 1];
+        const std::uint64_t max_len = std::min(first.size(), last.size());
+        std::uint64_t len = kpos;
+        while (len < max_len && first[len] == last[len]) {
+            ++len;
+        }
+        return len - kpos;
     }
 
     inline std::uint64_t xcheck(std::uint64_t lpos) const {
         if (m_units[taboo_npos].base == taboo_npos) {  // Full?
-            return m_units.size() ^ m_table.get_code(m_edges[0]);
+            return m_units.size() ^ m_edges[0];
         }
 
         // First, search in the same L1 block
         for (auto i = m_heads[lpos]; i != taboo_npos && i >> m_l1_bits == lpos; i = m_units[i].base) {
-            const auto base = i ^ m_table.get_code(m_edges[0]);
+            const auto base = i ^ m_edges[0];
             if (is_target(base)) {
                 return base;  // base / block_size_ == lpos
             }
@@ -244,17 +313,17 @@ class trie_builder {
 
         // Second, search in the other blocks
         for (auto i = m_units[taboo_npos].base; i != taboo_npos; i = m_units[i].base) {
-            const auto base = i ^ m_table.get_code(m_edges[0]);
+            const auto base = i ^ m_edges[0];
             if (is_target(base)) {
                 return base;  // base / block_size_ != lpos
             }
         }
-        return m_units.size() ^ m_table.get_code(m_edges[0]);
+        return m_units.size() ^ m_edges[0];
     }
 
     inline bool is_target(std::uint64_t base) const {
-        for (const auto ch : m_edges) {
-            if (m_useds[base ^ m_table.get_code(ch)]) {
+        for (const auto code : m_edges) {
+            if (m_useds[base ^ code]) {
                 return false;
             }
         }
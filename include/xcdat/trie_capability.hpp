@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace xcdat {
+
+//! The query operations supported by a trie, which decide the auxiliary structures built on the terminal flags.
+//!  - full: lookup, decode, and the searches with IDs (rank and select).
+//!  - lookup: lookup and the searches with IDs, but no decode (rank only).
+//!  - set: membership and the searches without IDs (neither rank nor select).
+//!  - fast_decode: the same as full, but the node positions of IDs are stored directly instead of select.
+//!  - counting: the same as full, plus the sampled numbers of keywords in subtrees for prefix counting.
+enum class trie_capability : std::uint32_t {
+    full = 0,
+    lookup = 1,
+    set = 2,
+    fast_decode = 3,
+    counting = 4,
+};
+
+}  // namespace xcdat
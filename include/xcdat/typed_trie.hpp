@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "exception.hpp"
+
+namespace xcdat {
+
+//! The order-preserving encoding of fixed-width keys into bytes.
+//! Unsigned integers are encoded in big-endian, so that the numerical order of integers is the same as
+//! the lexicographical order of their encodings. Byte arrays are stored as they are.
+template <class Key>
+struct key_codec;
+
+template <>
+struct key_codec<std::uint32_t> {
+    static constexpr std::uint64_t length = 4;
+
+    static inline std::array<char, length> encode(std::uint32_t key) {
+        std::array<char, length> bytes;
+        for (std::uint64_t i = 0; i < length; i++) {
+            bytes[i] = static_cast<char>(key >> (8 * (length - i - 1)));
+        }
+        return bytes;
+    }
+    static inline std::uint32_t decode(const char* bytes) {
+        std::uint32_t key = 0;
+        for (std::uint64_t i = 0; i < length; i++) {
+            key = (key << 8) | static_cast<std::uint8_t>(bytes[i]);
+        }
+        return key;
+    }
+};
+
+template <>
+struct key_codec<std::uint64_t> {
+    static constexpr std::uint64_t length = 8;
+
+    static inline std::array<char, length> encode(std::uint64_t key) {
+        std::array<char, length> bytes;
+        for (std::uint64_t i = 0; i < length; i++) {
+            bytes[i] = static_cast<char>(key >> (8 * (length - i - 1)));
+        }
+        return bytes;
+    }
+    static inline std::uint64_t decode(const char* bytes) {
+        std::uint64_t key = 0;
+        for (std::uint64_t i = 0; i < length; i++) {
+            key = (key << 8) | static_cast<std::uint8_t>(bytes[i]);
+        }
+        return key;
+    }
+};
+
+template <std::size_t N>
+struct key_codec<std::array<std::uint8_t, N>> {
+    static constexpr std::uint64_t length = N;
+
+    static inline std::array<char, length> encode(const std::array<std::uint8_t, N>& key) {
+        std::array<char, length> bytes;
+        for (std::uint64_t i = 0; i < length; i++) {
+            bytes[i] = static_cast<char>(key[i]);
+        }
+        return bytes;
+    }
+    static inline std::array<std::uint8_t, N> decode(const char* bytes) {
+        std::array<std::uint8_t, N> key;
+        for (std::uint64_t i = 0; i < length; i++) {
+            key[i] = static_cast<std::uint8_t>(bytes[i]);
+        }
+        return key;
+    }
+};
+
+//! A compressed dictionary of fixed-width keys such as integers and IPv6 addresses.
+//! 'Key' is the data type of keys supported by key_codec.
+//! 'Trie' is the data type of the trie storing the encoded keys, which must support 'decode'.
+//!
+//! The keys are encoded on the stack for queries and into a single buffer for construction, so no memory is
+//! allocated per key. Since all the encoded keys have the same length, the results are also decoded into
+//! fixed-size buffers on the stack, by scanning the characters of a keyword backward from its leaf.
+template <class Key, class Trie>
+class typed_trie {
+  public:
+    using key_type = Key;
+    using trie_type = Trie;
+    using bc_vector_type = typename trie_type::bc_vector_type;
+    using tail_vector_type = typename trie_type::tail_vector_type;
+    using code_table_type = typename trie_type::code_table_type;
+
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = (8U << 24) | trie_type::type_id;
+
+    //! The length of the encoded keys in bytes.
+    static constexpr std::uint64_t key_length = key_codec<key_type>::length;
+
+  private:
+    std::uint64_t m_key_length = key_length;
+    trie_type m_trie;
+
+  public:
+    //! Default constructor
+    typed_trie() = default;
+
+    //! Default destructor
+    virtual ~typed_trie() = default;
+
+    //! Copy constructor (deleted)
+    typed_trie(const typed_trie&) = delete;
+
+    //! Copy constructor (deleted)
+    typed_trie& operator=(const typed_trie&) = delete;
+
+    //! Move constructor
+    typed_trie(typed_trie&&) noexcept = default;
+
+    //! Move constructor
+    typed_trie& operator=(typed_trie&&) noexcept = default;
+
+    //! Build the trie from the input keys, which are sorted and unique.
+    //! The binary mode is set if the encoded keys contain NULL characters.
+    explicit typed_trie(const std::vector<key_type>& keys) {
+        std::vector<char> buffer(keys.size() * key_length);
+        for (std::uint64_t i = 0; i < keys.size(); i++) {
+            const auto bytes = key_codec<key_type>::encode(keys[i]);
+            std::copy(bytes.begin(), bytes.end(), buffer.data() + i * key_length);
+        }
+        std::vector<std::string_view> encoded_keys(keys.size());
+        for (std::uint64_t i = 0; i < keys.size(); i++) {
+            encoded_keys[i] = std::string_view(buffer.data() + i * key_length, key_length);
+        }
+        m_trie = trie_type(encoded_keys);
+    }
+
+    //! Check if the binary mode.
+    inline bool bin_mode() const {
+        return m_trie.bin_mode();
+    }
+
+    //! Get the number of stored keys.
+    inline std::uint64_t num_keys() const {
+        return m_trie.num_keys();
+    }
+
+    //! Get the number of trie nodes.
+    inline std::uint64_t num_nodes() const {
+        return m_trie.num_nodes();
+    }
+
+    //! Get the underlying trie.
+    inline const trie_type& underlying_trie() const {
+        return m_trie;
+    }
+
+    //! Lookup the ID of the key.
+    inline std::optional<std::uint64_t> lookup(const key_type& key) const {
+        const auto bytes = key_codec<key_type>::encode(key);
+        return m_trie.lookup(std::string_view(bytes.data(), key_length));
+    }
+
+    //! Check if the key is stored.
+    inline bool contains(const key_type& key) const {
+        const auto bytes = key_codec<key_type>::encode(key);
+        return m_trie.contains(std::string_view(bytes.data(), key_length));
+    }
+
+    //! Decode the key associated with the ID, which must be less than num_keys().
+    inline key_type decode(std::uint64_t id) const {
+        assert(id < num_keys());
+        std::array<char, key_length> bytes;
+        std::uint64_t i = key_length;
+        m_trie.reverse_scan(id, [&](char c) {
+            bytes[--i] = c;
+            return true;
+        });
+        assert(i == 0);
+        return key_codec<key_type>::decode(bytes.data());
+    }
+
+    //! Enumerate all the keys and their IDs in the ascending order of the keys.
+    //! The enumeration is terminated after 'limit' keys.
+    inline void enumerate(const std::function<void(std::uint64_t, const key_type&)>& fn,
+                          std::uint64_t limit = UINT64_MAX) const {
+        auto itr = m_trie.make_enumerative_iterator();
+        for (std::uint64_t i = 0; i < limit && itr.next(); i++) {
+            fn(itr.id(), key_codec<key_type>::decode(itr.decoded_view().data()));
+        }
+    }
+
+    //! Enumerate the keys in [lo, hi] and their IDs in the ascending order of the keys.
+    inline void range_search(const key_type& lo, const key_type& hi,
+                             const std::function<void(std::uint64_t, const key_type&)>& fn) const {
+        const auto lo_bytes = key_codec<key_type>::encode(lo);
+        const auto hi_bytes = key_codec<key_type>::encode(hi);
+        const std::string_view hi_view(hi_bytes.data(), key_length);
+        auto itr = m_trie.make_lower_bound_iterator(std::string_view(lo_bytes.data(), key_length));
+        while (itr.next() && itr.decoded_view() <= hi_view) {
+            fn(itr.id(), key_codec<key_type>::decode(itr.decoded_view().data()));
+        }
+    }
+
+    //! Visit the members (commonly used for I/O).
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_key_length);
+        XCDAT_THROW_IF(m_key_length != key_length, "The key length of the input dictionary is different.");
+        visitor.visit(m_trie);
+    }
+};
+
+}  // namespace xcdat
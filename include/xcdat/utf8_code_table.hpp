@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "exception.hpp"
+#include "immutable_vector.hpp"
+
+namespace xcdat {
+
+// A code table mapping each UTF-8 character to a code, where a more frequent character has a smaller code.
+// A transition of the double array consumes one character (i.e., up to four bytes), so the trie depth of
+// CJK keywords is about one third of that with the byte-wise code table.
+//
+// The symbol at a position is determined only by the leading byte: a byte in [0xC2,0xDF], [0xE0,0xEF],
+// or [0xF0,0xF4] starts a symbol of two, three, or four bytes, respectively, and any other byte is a
+// symbol of one byte. A symbol cut off by the end of a keyword consists of the remaining bytes. Since the
+// continuation bytes are not validated, any byte sequence can be stored, but a keyword ending in the middle
+// of a character is not found by prefix search of a longer query.
+class utf8_code_table {
+  public:
+    //! The type identifier.
+    static constexpr std::uint32_t type_id = 1;
+
+    //! The maximum number of bytes of a symbol (i.e., a transition label).
+    static constexpr std::uint64_t max_symbol_length = 4;
+
+  private:
+    std::uint64_t m_max_length = 0;
+    std::uint64_t m_block_size = 0;
+    std::array<std::uint32_t, 256> m_byte_codes;  // for symbols of one byte
+    std::uint64_t m_hash_mask = 0;
+    immutable_vector<std::uint64_t> m_hash_keys;  // for symbols of multiple bytes (0 is empty)
+    immutable_vector<std::uint32_t> m_hash_codes;
+    immutable_vector<char> m_symbols;  // max_symbol_length bytes per code
+    immutable_vector<std::uint8_t> m_lengths;
+    immutable_vector<std::uint32_t> m_sorted_codes;  // in the lexicographical order of symbols
+
+    struct counter_type {
+        std::string sym;
+        std::uint64_t freq;
+    };
+
+  public:
+    utf8_code_table() = default;
+    virtual ~utf8_code_table() = default;
+
+    utf8_code_table(const utf8_code_table&) = delete;
+    utf8_code_table& operator=(const utf8_code_table&) = delete;
+
+    utf8_code_table(utf8_code_table&&) noexcept = default;
+    utf8_code_table& operator=(utf8_code_table&&) noexcept = default;
+
+    template <class Strings>
+    utf8_code_table(const Strings& keys) {
+        std::unordered_map<std::uint64_t, std::uint64_t> freqs;  // packed symbol -> freq
+
+        m_max_length = 0;
+        for (const auto& key : keys) {
+            const std::string_view str(key.data(), key.size());
+            for (std::uint64_t kpos = 0; kpos < str.size();) {
+                const std::uint64_t len = symbol_length(str, kpos);
+                freqs[pack(str.substr(kpos, len))] += 1;
+                kpos += len;
+            }
+            m_max_length = std::max<std::uint64_t>(m_max_length, str.size());
+        }
+
+        std::vector<counter_type> counter;
+        counter.reserve(freqs.size());
+        for (const auto& [packed, freq] : freqs) {
+            counter.push_back({unpack(packed), freq});
+        }
+
+        // Sort the symbols in the lexicographical order, and assign smaller codes to more frequent ones.
+        std::sort(counter.begin(), counter.end(),
+                  [](const counter_type& a, const counter_type& b) { return a.sym < b.sym; });
+        std::vector<std::uint64_t> ranks(counter.size());
+        for (std::uint64_t i = 0; i < counter.size(); i++) {
+            ranks[i] = i;
+        }
+        std::stable_sort(ranks.begin(), ranks.end(),
+                         [&](std::uint64_t a, std::uint64_t b) { return counter[a].freq > counter[b].freq; });
+
+        const std::uint64_t num_symbols = counter.size();
+        const std::uint64_t unknown_code = num_symbols;
+
+        // Every code, including the one for unknown symbols, has to fit in a block.
+        m_block_size = 256;
+        while (m_block_size <= unknown_code) {
+            m_block_size <<= 1;
+        }
+
+        std::vector<std::uint32_t> sorted_codes(num_symbols);
+        std::vector<char> symbols(num_symbols * max_symbol_length, '\0');
+        std::vector<std::uint8_t> lengths(num_symbols);
+        for (std::uint64_t code = 0; code < num_symbols; code++) {
+            const std::string& sym = counter[ranks[code]].sym;
+            sorted_codes[ranks[code]] = static_cast<std::uint32_t>(code);
+            std::copy(sym.begin(), sym.end(), symbols.begin() + code * max_symbol_length);
+            lengths[code] = static_cast<std::uint8_t>(sym.size());
+        }
+
+        m_byte_codes.fill(static_cast<std::uint32_t>(unknown_code));
+
+        std::uint64_t hash_size = 2;
+        while (hash_size < num_symbols * 2) {
+            hash_size <<= 1;
+        }
+        m_hash_mask = hash_size - 1;
+
+        std::vector<std::uint64_t> hash_keys(hash_size, 0);
+        std::vector<std::uint32_t> hash_codes(hash_size, static_cast<std::uint32_t>(unknown_code));
+        for (std::uint64_t code = 0; code < num_symbols; code++) {
+            const std::string& sym = counter[ranks[code]].sym;
+            if (sym.size() == 1) {
+                m_byte_codes[static_cast<std::uint8_t>(sym[0])] = static_cast<std::uint32_t>(code);
+                continue;
+            }
+            const std::uint64_t packed = pack(sym);
+            std::uint64_t i = hash(packed);
+            while (hash_keys[i] != 0) {
+                i = (i + 1) & m_hash_mask;
+            }
+            hash_keys[i] = packed;
+            hash_codes[i] = static_cast<std::uint32_t>(code);
+        }
+
+        m_hash_keys.build(hash_keys);
+        m_hash_codes.build(hash_codes);
+        m_symbols.build(symbols);
+        m_lengths.build(lengths);
+        m_sorted_codes.build(sorted_codes);
+    }
+
+    inline std::uint64_t alphabet_size() const {
+        return m_sorted_codes.size();
+    }
+
+    inline std::uint64_t max_length() const {
+        return m_max_length;
+    }
+
+    // Returns the code of the symbol at key[kpos] and advances kpos to the next symbol.
+    // If the symbol is not in the alphabet, returns a code that is not used for any transition.
+    inline std::uint64_t get_code(std::string_view key, std::uint64_t& kpos) const {
+        if (key.size() <= kpos) {
+            return alphabet_size();
+        }
+        const std::uint64_t len = symbol_length(key, kpos);
+        if (len == 1) {
+            return m_byte_codes[static_cast<std::uint8_t>(key[kpos++])];
+        }
+        const std::uint64_t packed = pack(key.substr(kpos, len));
+        kpos += len;
+        for (std::uint64_t i = hash(packed);; i = (i + 1) & m_hash_mask) {
+            if (m_hash_keys[i] == packed || m_hash_keys[i] == 0) {
+                return m_hash_codes[i];
+            }
+        }
+    }
+
+    // Returns the symbol of the code.
+    inline std::string_view get_symbol(std::uint64_t cd) const {
+        return std::string_view(m_symbols.data() + cd * max_symbol_length, m_lengths[cd]);
+    }
+
+    // Returns the number of bytes of the symbol at key[kpos].
+    inline std::uint64_t symbol_length(std::string_view key, std::uint64_t kpos) const {
+        return std::min(declared_length(key[kpos]), key.size() - kpos);
+    }
+
+    // Checks if the symbol at key[kpos] is cut off by the end of key.
+    inline bool is_partial(std::string_view key, std::uint64_t kpos) const {
+        return key.size() < kpos + declared_length(key[kpos]);
+    }
+
+    // Returns the code of the i-th smallest symbol in the alphabet.
+    inline std::uint64_t nth_code(std::uint64_t i) const {
+        return m_sorted_codes[i];
+    }
+
+    // Returns the size of a double-array block, in which every code can be placed.
+    inline std::uint64_t block_size() const {
+        return m_block_size;
+    }
+
+    inline bool has_null() {
+        return m_byte_codes[0] != alphabet_size();
+    }
+
+    template <class Visitor>
+    void visit(Visitor& visitor) {
+        visitor.visit(m_max_length);
+        visitor.visit(m_block_size);
+        visitor.visit(m_byte_codes);
+        visitor.visit(m_hash_mask);
+        visitor.visit(m_hash_keys);
+        visitor.visit(m_hash_codes);
+        visitor.visit(m_symbols);
+        visitor.visit(m_lengths);
+        visitor.visit(m_sorted_codes);
+    }
+
+  private:
+    static inline std::uint64_t declared_length(char ch) {
+        const auto x = static_cast<std::uint8_t>(ch);
+        if (x < 0xC2) {
+            return 1;
+        } else if (x < 0xE0) {
+            return 2;
+        } else if (x < 0xF0) {
+            return 3;
+        } else if (x < 0xF5) {
+            return 4;
+        }
+        return 1;
+    }
+
+    // Packs a symbol into a non-zero integer (the length in the lowest byte and the bytes above it).
+    static inline std::uint64_t pack(std::string_view sym) {
+        std::uint64_t packed = sym.size();
+        for (std::uint64_t i = 0; i < sym.size(); i++) {
+            packed |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(sym[i])) << ((i + 1) * 8);
+        }
+        return packed;
+    }
+
+    static inline std::string unpack(std::uint64_t packed) {
+        std::string sym(packed & 0xFFULL, '\0');
+        for (std::uint64_t i = 0; i < sym.size(); i++) {
+            sym[i] = static_cast<char>((packed >> ((i + 1) * 8)) & 0xFFULL);
+        }
+        return sym;
+    }
+
+    inline std::uint64_t hash(std::uint64_t packed) const {
+        return ((packed * 0x9E3779B97F4A7C15ULL) >> 32) & m_hash_mask;
+    }
+};
+
+}  // namespace xcdat
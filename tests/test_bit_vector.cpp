@@ -28,6 +28,15 @@ std::uint64_t select_naive(const std::vector<bool>& bits, std::uint64_t n) {
     return i;
 }
 
+std::uint64_t successor_naive(const std::vector<bool>& bits, std::uint64_t i) {
+    for (; i < bits.size(); i++) {
+        if (bits[i]) {
+            break;
+        }
+    }
+    return i;
+}
+
 void test_rank_select(const std::vector<bool>& bits) {
     xcdat::bit_vector bv;
     {
@@ -62,6 +71,13 @@ void test_rank_select(const std::vector<bool>& bits) {
             REQUIRE_EQ(bv.select(n), select_naive(bits, n));
         }
     }
+    if (bv.size() != 0) {
+        std::uniform_int_distribution<std::uint64_t> dist(0, bv.size() - 1);
+        for (std::uint64_t r = 0; r < 100; r++) {
+            const std::uint64_t i = dist(engine);
+            REQUIRE_EQ(bv.successor(i), successor_naive(bits, i));
+        }
+    }
 }
 
 TEST_CASE("Test bit_vector::builder with resize") {
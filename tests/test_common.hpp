@@ -62,6 +62,45 @@ std::vector<std::string> make_random_keys(std::uint64_t n, std::uint64_t min_m,
     return keys;
 }
 
+void append_utf8(std::string& str, std::uint32_t cp) {
+    if (cp < 0x80) {
+        str.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        str.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        str.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        str.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        str.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+// Makes random UTF-8 keys consisting of 1-, 2-, 3-, and 4-byte characters.
+std::vector<std::string> make_random_utf8_keys(std::uint64_t n, std::uint64_t min_m, std::uint64_t max_m,
+                                               std::uint64_t seed = 13) {
+    static const std::vector<std::uint32_t> cps = {
+        'A', 'B', 'C', 0xE0, 0xE1, 0x3041, 0x3042, 0x3043, 0x3044, 0x4E00, 0x4E01, 0x1F600, 0x1F601,
+    };
+
+    std::mt19937_64 engine(seed);
+    std::uniform_int_distribution<std::uint64_t> dist_m(min_m, max_m);
+    std::uniform_int_distribution<std::uint64_t> dist_c(0, cps.size() - 1);
+
+    std::vector<std::string> keys(n);
+    for (std::uint64_t i = 0; i < n; i++) {
+        const std::uint64_t m = dist_m(engine);
+        for (std::uint64_t j = 0; j < m; j++) {
+            append_utf8(keys[i], cps[dist_c(engine)]);
+        }
+    }
+    return keys;
+}
+
 std::vector<std::string> extract_keys(std::vector<std::string>& keys, double ratio = 0.1, std::uint64_t seed = 13) {
     std::mt19937_64 engine(seed);
     std::uniform_real_distribution<double> dist(0.0, 1.0);
@@ -0,0 +1,54 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <algorithm>
+#include <random>
+
+#include "doctest/doctest.h"
+#include "test_common.hpp"
+#include "xcdat/front_coded_vector.hpp"
+
+void test_front_coded_vector(const std::vector<std::string>& strs) {
+    xcdat::front_coded_vector fcv(strs);
+
+    REQUIRE_EQ(fcv.size(), strs.size());
+
+    std::string decoded;
+    for (std::uint64_t i = 0; i < strs.size(); i++) {
+        fcv.decode(i, decoded);
+        REQUIRE_EQ(decoded, strs[i]);
+    }
+
+    // Random access reusing the buffer of a longer string
+    std::mt19937_64 engine(13);
+    std::uniform_int_distribution<std::uint64_t> dist(0, strs.size() - 1);
+    for (std::uint64_t i = 0; i < 1000; i++) {
+        const std::uint64_t j = dist(engine);
+        fcv.decode(j, decoded);
+        REQUIRE_EQ(decoded, strs[j]);
+    }
+}
+
+TEST_CASE("Test xcdat::front_coded_vector (tiny)") {
+    std::vector<std::string> strs = {
+        "",         "AirPods", "AirTag", "Mac",  "MacBook", "MacBook_Air", "MacBook_Pro",
+        "Mac_Mini", "Mac_Pro", "iMac",   "iPad", "iPhone",  "iPhone_SE",
+    };
+    test_front_coded_vector(strs);
+}
+
+TEST_CASE("Test xcdat::front_coded_vector (unsorted)") {
+    // The strings need not be sorted, while sorted strings are compressed better.
+    std::vector<std::string> strs = {"MacBook", "AirTag", "MacBook", "", "Mac", "iPhone_SE", "iPhone", "A"};
+    test_front_coded_vector(strs);
+}
+
+TEST_CASE("Test xcdat::front_coded_vector (random 10K, A--B)") {
+    auto strs = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, 'A', 'B'));
+    test_front_coded_vector(strs);
+}
+
+TEST_CASE("Test xcdat::front_coded_vector (random 10K, long)") {
+    // Suffixes longer than 127 bytes need multi-byte lengths.
+    auto strs = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 100, 300, INT8_MIN, INT8_MAX));
+    test_front_coded_vector(strs);
+}
@@ -0,0 +1,131 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+
+#include "doctest/doctest.h"
+#include "mm_file/mm_file.hpp"
+#include "test_common.hpp"
+#include "xcdat.hpp"
+
+using trie_type = xcdat::trie_8_infix_type;
+
+std::vector<std::string> load_strings(const std::string& filepath, char delim = '\n') {
+    std::ifstream ifs(filepath);
+    XCDAT_THROW_IF(!ifs.good(), "Cannot open the input file");
+
+    std::vector<std::string> strs;
+    for (std::string str; std::getline(ifs, str, delim);) {
+        strs.push_back(str);
+    }
+    return strs;
+}
+
+std::vector<std::string> infix_search_naive(const std::vector<std::string>& keys, std::string_view query) {
+    std::vector<std::string> results;
+    for (auto& key : keys) {
+        if (key.find(query) != std::string::npos) {
+            results.push_back(key);
+        }
+    }
+    return results;
+}
+
+void test_infix_search(const trie_type& trie, const std::vector<std::string>& keys,
+                       const std::vector<std::string>& queries) {
+    REQUIRE_EQ(trie.num_keys(), keys.size());
+
+    for (auto& query : queries) {
+        // Patterns shorter than, equal to, and longer than q
+        for (std::uint64_t len : {std::uint64_t(2), std::uint64_t(3), std::uint64_t(5), query.size()}) {
+            const std::string_view pattern = std::string_view(query).substr(query.size() / 3, len);
+            auto expected = infix_search_naive(keys, pattern);
+
+            std::vector<std::string> results;
+            std::optional<std::uint64_t> prev_id;
+            trie.infix_search(pattern, [&](std::uint64_t id, std::string_view str) {
+                REQUIRE_EQ(trie.decode(id), str);
+                if (prev_id.has_value()) {
+                    REQUIRE_LT(prev_id.value(), id);
+                }
+                prev_id = id;
+                results.emplace_back(str);
+            });
+            std::sort(results.begin(), results.end());
+            REQUIRE_EQ(results, expected);
+
+            std::uint64_t num_results = 0;
+            trie.infix_search(pattern, [&](std::uint64_t, std::string_view) { num_results += 1; }, 2);
+            REQUIRE_EQ(num_results, std::min<std::uint64_t>(expected.size(), 2));
+        }
+    }
+}
+
+void test_io(const trie_type& trie, const std::vector<std::string>& keys) {
+    const char* tmp_filepath = "tmp.idx";
+
+    const std::uint64_t memory = xcdat::memory_in_bytes(trie);
+    REQUIRE_EQ(memory, xcdat::save(trie, tmp_filepath));
+    REQUIRE_EQ(xcdat::get_type_id(tmp_filepath), trie_type::type_id);
+
+    {
+        mm::file_source<char> fin(tmp_filepath, mm::advice::sequential);
+        const auto mapped = xcdat::mmap<trie_type>(fin.data());
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(mapped));
+        for (auto& key : xcdat::test::sample_keys(keys, 100)) {
+            std::uint64_t num_results = 0;
+            mapped.infix_search(key, [&](std::uint64_t id, std::string_view) { num_results += id == trie.lookup(key); });
+            REQUIRE_EQ(num_results, 1);
+        }
+    }
+
+    std::remove(tmp_filepath);
+}
+
+TEST_CASE("Test xcdat::infix_trie (tiny)") {
+    std::vector<std::string> keys = {
+        "AirPods",  "AirTag",  "Mac",  "MacBook", "MacBook_Air", "MacBook_Pro",
+        "Mac_Mini", "Mac_Pro", "iMac", "iPad",    "iPhone",      "iPhone_SE",
+    };
+    trie_type trie(keys);
+
+    std::vector<std::string> results;
+    trie.infix_search("Book", [&](std::uint64_t, std::string_view str) { results.emplace_back(str); });
+    std::sort(results.begin(), results.end());
+    REQUIRE_EQ(results, std::vector<std::string>{"MacBook", "MacBook_Air", "MacBook_Pro"});
+
+    results.clear();
+    trie.infix_search("Pad", [&](std::uint64_t, std::string_view str) { results.emplace_back(str); });
+    REQUIRE_EQ(results, std::vector<std::string>{"iPad"});
+
+    results.clear();
+    trie.infix_search("", [&](std::uint64_t, std::string_view str) { results.emplace_back(str); });
+    REQUIRE_EQ(results.size(), keys.size());
+
+    test_infix_search(trie, keys, {"Google_Pixel", "iPad", "Air", "SE", "Mini"});
+    test_io(trie, keys);
+}
+
+TEST_CASE("Test xcdat::infix_trie (random 10K, A--B)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, 'A', 'B'));
+    auto others = xcdat::test::extract_keys(keys);
+    trie_type trie(keys);
+    test_infix_search(trie, keys, xcdat::test::sample_keys(others, 100));
+    test_io(trie, keys);
+}
+
+TEST_CASE("Test xcdat::infix_trie (random 10K, 0x00--0xFF)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, INT8_MIN, INT8_MAX));
+    auto others = xcdat::test::extract_keys(keys);
+    trie_type trie(keys, true);
+    test_infix_search(trie, keys, xcdat::test::sample_keys(others, 100));
+}
+
+TEST_CASE("Test xcdat::infix_trie (real)") {
+    auto keys = xcdat::test::to_unique_vec(load_strings("keys.txt"));
+    auto others = xcdat::test::extract_keys(keys);
+    trie_type trie(keys);
+    test_infix_search(trie, keys, xcdat::test::sample_keys(others, 100));
+}
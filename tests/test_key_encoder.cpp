@@ -0,0 +1,63 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <algorithm>
+#include <random>
+
+#include "doctest/doctest.h"
+#include "test_common.hpp"
+#include "xcdat/key_encoder.hpp"
+
+void test_key_encoder(const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+    const xcdat::key_encoder encoder(keys);
+    REQUIRE_LE(encoder.num_intervals(), xcdat::key_encoder::max_intervals);
+    REQUIRE_EQ(encoder.max_length(), xcdat::test::max_length(keys));
+
+    // Strings not used in the training are also encoded in the order-preserving way.
+    std::vector<std::string> strs = keys;
+    strs.insert(strs.end(), others.begin(), others.end());
+    strs = xcdat::test::to_unique_vec(std::move(strs));
+
+    std::vector<std::string> encoded(strs.size());
+    for (std::uint64_t i = 0; i < strs.size(); i++) {
+        encoder.encode(strs[i], encoded[i]);
+        std::string decoded;
+        encoder.decode(encoded[i], decoded);
+        REQUIRE_EQ(strs[i], decoded);
+    }
+    for (std::uint64_t i = 1; i < strs.size(); i++) {
+        REQUIRE_LT(encoded[i - 1], encoded[i]);
+    }
+}
+
+TEST_CASE("Test xcdat::key_encoder (tiny)") {
+    std::vector<std::string> keys = {
+        "AirPods",  "AirTag",  "Mac",  "MacBook", "MacBook_Air", "MacBook_Pro",
+        "Mac_Mini", "Mac_Pro", "iMac", "iPad",    "iPhone",      "iPhone_SE",
+    };
+    std::vector<std::string> others = {
+        "", "Google_Pixel", "iPad_mini", "iPadOS", "iPod", "ThinkPad", "MacBook\xFF", "\xFF\xFF", "Mac\x01",
+    };
+    test_key_encoder(keys, others);
+}
+
+TEST_CASE("Test xcdat::key_encoder (repetitive)") {
+    std::vector<std::string> keys;
+    for (const auto& path : xcdat::test::make_random_keys(10000, 1, 10, 'A', 'C')) {
+        keys.push_back("https://www.example.com/" + path + "/index.html");
+    }
+    keys = xcdat::test::to_unique_vec(std::move(keys));
+    auto others = xcdat::test::make_random_keys(1000, 1, 30, 'A', 'z', 17);
+    test_key_encoder(keys, others);
+}
+
+TEST_CASE("Test xcdat::key_encoder (random, A--Z)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, 'A', 'Z'));
+    auto others = xcdat::test::make_random_keys(1000, 1, 30, INT8_MIN, INT8_MAX, 17);
+    test_key_encoder(keys, others);
+}
+
+TEST_CASE("Test xcdat::key_encoder (random, 0x00--0xFF)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, INT8_MIN, INT8_MAX));
+    auto others = xcdat::test::make_random_keys(1000, 1, 30, INT8_MIN, INT8_MAX, 17);
+    test_key_encoder(keys, others);
+}
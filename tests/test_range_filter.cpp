@@ -0,0 +1,179 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+#include "doctest/doctest.h"
+#include "mm_file/mm_file.hpp"
+#include "test_common.hpp"
+#include "xcdat.hpp"
+
+using filter_type = xcdat::range_filter_8_type;
+using suffix_mode = filter_type::suffix_mode;
+
+bool contains_range_naive(const std::vector<std::string>& keys, std::string_view lo, std::string_view hi) {
+    auto it = std::lower_bound(keys.begin(), keys.end(), lo);
+    return it != keys.end() && *it <= hi;
+}
+
+// Returns the ratio of false positives of point queries.
+double test_point_queries(const filter_type& filter, const std::vector<std::string>& keys,
+                          const std::vector<std::string>& others) {
+    REQUIRE_EQ(filter.num_keys(), keys.size());
+
+    for (auto& key : keys) {
+        REQUIRE(filter.may_contain(key));
+    }
+
+    std::uint64_t num_fps = 0;
+    for (auto& other : others) {
+        num_fps += filter.may_contain(other) ? 1 : 0;
+    }
+    return others.empty() ? 0.0 : double(num_fps) / others.size();
+}
+
+// Returns the ratio of false positives of range queries.
+double test_range_queries(const filter_type& filter, const std::vector<std::string>& keys,
+                          const std::vector<std::string>& others) {
+    std::vector<std::string> bounds = keys;
+    bounds.insert(bounds.end(), others.begin(), others.end());
+    for (auto& other : others) {
+        bounds.push_back(other.substr(0, other.size() / 2));
+    }
+
+    std::mt19937_64 engine(13);
+    std::uniform_int_distribution<std::uint64_t> dist(0, bounds.size() - 1);
+
+    std::uint64_t num_negatives = 0, num_fps = 0;
+    for (std::uint64_t i = 0; i < 10000; i++) {
+        std::string lo = bounds[dist(engine)];
+        std::string hi = bounds[dist(engine)];
+        if (hi < lo) {
+            std::swap(lo, hi);
+        }
+        if (contains_range_naive(keys, lo, hi)) {
+            REQUIRE(filter.may_contain_range(lo, hi));
+        } else {
+            num_negatives += 1;
+            num_fps += filter.may_contain_range(lo, hi) ? 1 : 0;
+        }
+        REQUIRE_FALSE(filter.may_contain_range(hi + '\0', lo));
+    }
+
+    for (auto& key : keys) {
+        REQUIRE(filter.may_contain_range(key, key));
+    }
+    return num_negatives == 0 ? 0.0 : double(num_fps) / num_negatives;
+}
+
+void test_io(const filter_type& filter, const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+    const char* tmp_filepath = "tmp.idx";
+
+    const std::uint64_t memory = xcdat::memory_in_bytes(filter);
+    REQUIRE_EQ(memory, xcdat::save(filter, tmp_filepath));
+
+    {
+        const auto loaded = xcdat::load<filter_type>(tmp_filepath);
+        REQUIRE(loaded.mode() == filter.mode());
+        REQUIRE_EQ(loaded.suffix_bits(), filter.suffix_bits());
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(loaded));
+        for (auto& other : others) {
+            REQUIRE_EQ(filter.may_contain(other), loaded.may_contain(other));
+        }
+        test_point_queries(loaded, keys, {});
+    }
+
+    {
+        mm::file_source<char> fin(tmp_filepath, mm::advice::sequential);
+        const auto mapped = xcdat::mmap<filter_type>(fin.data());
+        REQUIRE(mapped.mode() == filter.mode());
+        REQUIRE_EQ(mapped.suffix_bits(), filter.suffix_bits());
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(mapped));
+        for (auto& other : others) {
+            REQUIRE_EQ(filter.may_contain(other), mapped.may_contain(other));
+        }
+        test_point_queries(mapped, keys, {});
+    }
+
+    std::remove(tmp_filepath);
+}
+
+TEST_CASE("Test xcdat::range_filter (tiny)") {
+    std::vector<std::string> keys = {
+        "AirPods",  "AirTag",  "Mac",  "MacBook", "MacBook_Air", "MacBook_Pro",
+        "Mac_Mini", "Mac_Pro", "iMac", "iPad",    "iPhone",      "iPhone_SE",
+    };
+
+    const filter_type filter(keys, 8, suffix_mode::real);
+    test_point_queries(filter, keys, {});
+
+    REQUIRE_FALSE(filter.may_contain("Google_Pixel"));
+    REQUIRE_FALSE(filter.may_contain("Ma"));
+    REQUIRE_FALSE(filter.may_contain("MacBook_"));
+
+    REQUIRE(filter.may_contain_range("MacBook_B", "MacBook_Q"));
+    REQUIRE(filter.may_contain_range("A", "B"));
+    REQUIRE(filter.may_contain_range("Mac_", "Mac_Z"));
+    REQUIRE_FALSE(filter.may_contain_range("B", "L"));
+    REQUIRE_FALSE(filter.may_contain_range("MacBook_Q", "MacBook_Z"));
+    REQUIRE_FALSE(filter.may_contain_range("j", "z"));
+}
+
+TEST_CASE("Test xcdat::range_filter (suffix bits)") {
+    REQUIRE_EQ(filter_type::suffix_bits_for(0.5), 1);
+    REQUIRE_EQ(filter_type::suffix_bits_for(0.01), 7);
+    REQUIRE_EQ(filter_type::suffix_bits_for(1e-20), filter_type::max_suffix_bits);
+
+    std::vector<std::string> keys = {"A", "B"};
+    auto func = [&]() { auto filter = filter_type(keys, filter_type::max_suffix_bits + 1); };
+    REQUIRE_THROWS_AS(func(), const xcdat::exception&);
+    REQUIRE_THROWS_AS(filter_type::suffix_bits_for(0.0), const xcdat::exception&);
+}
+
+TEST_CASE("Test xcdat::range_filter (random 10K, A--Z)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, 'A', 'Z'));
+    auto others = xcdat::test::extract_keys(keys);
+
+    for (std::uint64_t bits : {0, 4, 8, 16}) {
+        const filter_type filter(keys, bits, suffix_mode::hash);
+        const double fpr = test_point_queries(filter, keys, others);
+        REQUIRE_LE(fpr, 2.0 / (1ULL << bits));
+        test_range_queries(filter, keys, others);
+        test_io(filter, keys, others);
+    }
+
+    for (std::uint64_t bits : {0, 4, 8, 16}) {
+        const filter_type filter(keys, bits, suffix_mode::real);
+        test_point_queries(filter, keys, others);
+        const double fpr = test_range_queries(filter, keys, others);
+        if (bits == 16) {
+            REQUIRE_LT(fpr, 0.1);
+        }
+        test_io(filter, keys, others);
+    }
+}
+
+TEST_CASE("Test xcdat::range_filter (random 10K, 0x00--0xFF)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, INT8_MIN, INT8_MAX));
+    auto others = xcdat::test::extract_keys(keys);
+
+    for (auto mode : {suffix_mode::hash, suffix_mode::real}) {
+        const filter_type filter(keys, 8, mode);
+        test_point_queries(filter, keys, others);
+        test_range_queries(filter, keys, others);
+        test_io(filter, keys, others);
+    }
+}
+
+TEST_CASE("Test xcdat::range_filter (unsort)") {
+    std::vector<std::string> keys = {"B", "A"};
+    auto func = [&]() { auto filter = filter_type(keys); };
+    REQUIRE_THROWS_AS(func(), const xcdat::exception&);
+}
+
+TEST_CASE("Test xcdat::range_filter (not unique)") {
+    std::vector<std::string> keys = {"A", "B", "B"};
+    auto func = [&]() { auto filter = filter_type(keys); };
+    REQUIRE_THROWS_AS(func(), const xcdat::exception&);
+}
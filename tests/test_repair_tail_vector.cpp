@@ -0,0 +1,70 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <algorithm>
+#include <random>
+
+#include "doctest/doctest.h"
+#include "test_common.hpp"
+#include "xcdat/repair_tail_vector.hpp"
+
+void test_repair_tail_vector(const std::vector<std::string>& sufs, bool bin_mode = false) {
+    xcdat::repair_tail_vector tvec;
+    std::vector<std::uint64_t> idxs(sufs.size());
+
+    {
+        xcdat::repair_tail_vector::builder tvb;
+        for (std::uint64_t i = 0; i < sufs.size(); i++) {
+            tvb.set_suffix(sufs[i], i);
+        }
+        tvb.complete(bin_mode, [&](std::uint64_t npos, std::uint64_t tpos) { idxs[npos] = tpos; });
+        tvec = xcdat::repair_tail_vector(std::move(tvb));
+    }
+
+    REQUIRE_EQ(tvec.bin_mode(), bin_mode);
+
+    for (std::uint64_t i = 0; i < sufs.size(); i++) {
+        REQUIRE(tvec.match(sufs[i], idxs[i]));
+    }
+    for (std::uint64_t i = 0; i < sufs.size(); i++) {
+        const std::string_view suf = sufs[i];
+        REQUIRE_EQ(tvec.prefix_match(sufs[i] + "_", idxs[i]), suf.size());
+        REQUIRE_FALSE(tvec.prefix_match(suf.substr(0, suf.size() - 1), idxs[i]).has_value());
+        REQUIRE(tvec.predictive_match(suf.substr(0, suf.size() / 2), idxs[i]));
+        REQUIRE_FALSE(tvec.predictive_match(sufs[i] + "_", idxs[i]));
+        REQUIRE_FALSE(tvec.match(sufs[i] + std::string(1, '\0'), idxs[i]));
+        REQUIRE_FALSE(tvec.match(suf.substr(0, suf.size() - 1), idxs[i]));
+    }
+    for (std::uint64_t i = 0; i < sufs.size(); i++) {
+        std::string decoded;
+        tvec.decode(idxs[i], decoded);
+        REQUIRE_EQ(sufs[i], decoded);
+    }
+}
+
+TEST_CASE("Test xcdat::repair_tail_vector (tiny)") {
+    std::vector<std::string> sufs = {"ML", "STATS", "A", "M", "L", "AKDD", "M", "R", "DD", "OD"};
+    test_repair_tail_vector(sufs);
+}
+
+TEST_CASE("Test xcdat::repair_tail_vector (repetitive)") {
+    std::vector<std::string> sufs;
+    for (const auto& suf : xcdat::test::make_random_keys(1000, 1, 10, 'A', 'C')) {
+        sufs.push_back("http://www.example.com/" + suf + "/index.html");
+    }
+    test_repair_tail_vector(sufs);
+}
+
+TEST_CASE("Test xcdat::repair_tail_vector (random, A--B)") {
+    std::vector<std::string> sufs = xcdat::test::make_random_keys(10000, 1, 30, 'A', 'B');
+    test_repair_tail_vector(sufs);
+}
+
+TEST_CASE("Test xcdat::repair_tail_vector (random, A--Z)") {
+    std::vector<std::string> sufs = xcdat::test::make_random_keys(10000, 1, 30, 'A', 'Z');
+    test_repair_tail_vector(sufs);
+}
+
+TEST_CASE("Test xcdat::repair_tail_vector (random, 0x00--0xFF)") {
+    std::vector<std::string> sufs = xcdat::test::make_random_keys(10000, 1, 30, INT8_MIN, INT8_MAX);
+    test_repair_tail_vector(sufs, true);
+}
@@ -0,0 +1,131 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "doctest/doctest.h"
+#include "mm_file/mm_file.hpp"
+#include "test_common.hpp"
+#include "xcdat.hpp"
+
+using trie_type = xcdat::trie_8_suffix_type;
+
+std::vector<std::string> load_strings(const std::string& filepath, char delim = '\n') {
+    std::ifstream ifs(filepath);
+    XCDAT_THROW_IF(!ifs.good(), "Cannot open the input file");
+
+    std::vector<std::string> strs;
+    for (std::string str; std::getline(ifs, str, delim);) {
+        strs.push_back(str);
+    }
+    return strs;
+}
+
+std::vector<std::string> suffix_search_naive(const std::vector<std::string>& keys, std::string_view query) {
+    std::vector<std::string> results;
+    for (auto& key : keys) {
+        if (query.size() <= key.size() && std::string_view(key).substr(key.size() - query.size()) == query) {
+            results.push_back(key);
+        }
+    }
+    return results;
+}
+
+void test_suffix_search(const trie_type& trie, const std::vector<std::string>& keys,
+                        const std::vector<std::string>& queries) {
+    REQUIRE_EQ(trie.num_keys(), keys.size());
+
+    for (auto& key : keys) {
+        REQUIRE_EQ(trie.decode(trie.lookup(key).value()), key);
+    }
+
+    for (auto& query : queries) {
+        for (std::uint64_t len : {query.size(), query.size() / 2, std::uint64_t(1)}) {
+            const std::string_view suffix = std::string_view(query).substr(query.size() - std::min(len, query.size()));
+            auto expected = suffix_search_naive(keys, suffix);
+
+            std::vector<std::string> results;
+            trie.suffix_search(suffix, [&](std::uint64_t id, std::string_view str) {
+                REQUIRE_EQ(trie.decode(id), str);
+                results.emplace_back(str);
+            });
+            std::sort(results.begin(), results.end());
+            REQUIRE_EQ(results, expected);
+
+            std::vector<std::uint64_t> ids;
+            trie.suffix_search_ids(suffix, [&](std::uint64_t id) { ids.push_back(id); });
+            REQUIRE_EQ(ids.size(), expected.size());
+
+            ids.clear();
+            trie.suffix_search_ids(suffix, [&](std::uint64_t id) { ids.push_back(id); }, 2);
+            REQUIRE_EQ(ids.size(), std::min<std::uint64_t>(expected.size(), 2));
+        }
+    }
+}
+
+void test_io(const trie_type& trie, const std::vector<std::string>& keys) {
+    const char* tmp_filepath = "tmp.idx";
+
+    const std::uint64_t memory = xcdat::memory_in_bytes(trie);
+    REQUIRE_EQ(memory, xcdat::save(trie, tmp_filepath));
+    REQUIRE_EQ(xcdat::get_type_id(tmp_filepath), trie_type::type_id);
+
+    {
+        mm::file_source<char> fin(tmp_filepath, mm::advice::sequential);
+        const auto mapped = xcdat::mmap<trie_type>(fin.data());
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(mapped));
+        for (auto& key : keys) {
+            std::uint64_t num_results = 0;
+            mapped.suffix_search_ids(key, [&](std::uint64_t id) { num_results += id == trie.lookup(key) ? 1 : 0; });
+            REQUIRE_EQ(num_results, 1);
+        }
+    }
+
+    std::remove(tmp_filepath);
+}
+
+TEST_CASE("Test xcdat::suffix_trie (tiny)") {
+    std::vector<std::string> keys = {
+        "AirPods",  "AirTag",  "Mac",  "MacBook", "MacBook_Air", "MacBook_Pro",
+        "Mac_Mini", "Mac_Pro", "iMac", "iPad",    "iPhone",      "iPhone_SE",
+    };
+    trie_type trie(keys);
+
+    std::vector<std::string> results;
+    trie.suffix_search("Pro", [&](std::uint64_t, std::string_view str) { results.emplace_back(str); });
+    REQUIRE_EQ(results, std::vector<std::string>{"Mac_Pro", "MacBook_Pro"});  // in the order of reversals
+
+    results.clear();
+    trie.suffix_search("ac", [&](std::uint64_t, std::string_view str) { results.emplace_back(str); });
+    REQUIRE_EQ(results, std::vector<std::string>{"Mac", "iMac"});
+
+    results.clear();
+    trie.suffix_search("", [&](std::uint64_t, std::string_view str) { results.emplace_back(str); });
+    REQUIRE_EQ(results.size(), keys.size());
+
+    test_suffix_search(trie, keys, {"Google_Pixel", "iPad", "Air", "SE", "Mini"});
+    test_io(trie, keys);
+}
+
+TEST_CASE("Test xcdat::suffix_trie (random 10K, A--B)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, 'A', 'B'));
+    auto others = xcdat::test::extract_keys(keys);
+    trie_type trie(keys);
+    test_suffix_search(trie, keys, xcdat::test::sample_keys(others, 100));
+    test_io(trie, keys);
+}
+
+TEST_CASE("Test xcdat::suffix_trie (random 10K, 0x00--0xFF)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, INT8_MIN, INT8_MAX));
+    auto others = xcdat::test::extract_keys(keys);
+    trie_type trie(keys, true);
+    test_suffix_search(trie, keys, xcdat::test::sample_keys(others, 100));
+}
+
+TEST_CASE("Test xcdat::suffix_trie (real)") {
+    auto keys = xcdat::test::to_unique_vec(load_strings("keys.txt"));
+    auto others = xcdat::test::extract_keys(keys);
+    trie_type trie(keys);
+    test_suffix_search(trie, keys, xcdat::test::sample_keys(others, 100));
+}
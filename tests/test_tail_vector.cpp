@@ -23,10 +23,20 @@ void test_tail_vector(const std::vector<std::string>& sufs, bool bin_mode = fals
     for (std::uint64_t i = 0; i < sufs.size(); i++) {
         REQUIRE(tvec.match(sufs[i], idxs[i]));
     }
+    for (std::uint64_t i = 0; i < sufs.size(); i++) {
+        const std::string_view suf = sufs[i];
+        REQUIRE_EQ(tvec.prefix_match(sufs[i] + "_", idxs[i]), suf.size());
+        REQUIRE_FALSE(tvec.prefix_match(suf.substr(0, suf.size() - 1), idxs[i]).has_value());
+        REQUIRE(tvec.predictive_match(suf.substr(0, suf.size() / 2), idxs[i]));
+        REQUIRE_FALSE(tvec.predictive_match(sufs[i] + "_", idxs[i]));
+        REQUIRE_FALSE(tvec.match(sufs[i] + std::string(1, '\0'), idxs[i]));
+        REQUIRE_FALSE(tvec.match(suf.substr(0, suf.size() - 1), idxs[i]));
+    }
     for (std::uint64_t i = 0; i < sufs.size(); i++) {
         std::string decoded;
-        tvec.decode(idxs[i], [&](char c) { decoded.push_back(c); });
+        tvec.decode(idxs[i], decoded);
         REQUIRE_EQ(sufs[i], decoded);
+        REQUIRE_EQ(tvec.length(idxs[i]), sufs[i].size());
     }
 }
 
@@ -35,6 +45,11 @@ TEST_CASE("Test xcdat::tail_vector (tiny)") {
     test_tail_vector(sufs);
 }
 
+TEST_CASE("Test xcdat::tail_vector (long)") {
+    std::vector<std::string> sufs = xcdat::test::make_random_keys(1000, 10, 100, 'A', 'C');
+    test_tail_vector(sufs);
+}
+
 TEST_CASE("Test xcdat::tail_vector (random, A--B)") {
     std::vector<std::string> sufs = xcdat::test::make_random_keys(10000, 1, 30, 'A', 'B');
     test_tail_vector(sufs);
@@ -0,0 +1,284 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+
+#include "doctest/doctest.h"
+#include "mm_file/mm_file.hpp"
+#include "test_common.hpp"
+#include "xcdat.hpp"
+
+using full_type = xcdat::trie_8_type;
+using lookup_type = xcdat::trie_8_lookup_type;
+using set_type = xcdat::trie_8_set_type;
+using fast_decode_type = xcdat::trie_8_fast_decode_type;
+using counting_type = xcdat::trie_8_counting_type;
+
+std::vector<std::string> load_strings(const std::string& filepath, char delim = '\n') {
+    std::ifstream ifs(filepath);
+    XCDAT_THROW_IF(!ifs.good(), "Cannot open the input file");
+
+    std::vector<std::string> strs;
+    for (std::string str; std::getline(ifs, str, delim);) {
+        strs.push_back(str);
+    }
+    return strs;
+}
+
+void test_lookup(const lookup_type& trie, const full_type& full, const std::vector<std::string>& keys,
+                 const std::vector<std::string>& others) {
+    REQUIRE_EQ(trie.num_keys(), full.num_keys());
+    REQUIRE_EQ(trie.num_nodes(), full.num_nodes());
+
+    for (auto& key : keys) {
+        REQUIRE(trie.contains(key));
+        REQUIRE_EQ(trie.lookup(key).value(), full.lookup(key).value());
+    }
+    for (auto& other : others) {
+        REQUIRE_FALSE(trie.contains(other));
+        REQUIRE_FALSE(trie.lookup(other).has_value());
+    }
+
+    for (std::uint64_t i = 0; i < std::min<std::uint64_t>(others.size(), 1000); i++) {
+        const auto& query = others[i];
+        std::vector<std::pair<std::uint64_t, std::string>> expected, results;
+        full.predictive_search(query.substr(0, 2), [&](std::uint64_t id, std::string_view str) {
+            expected.emplace_back(id, std::string(str));
+        });
+        trie.predictive_search(query.substr(0, 2), [&](std::uint64_t id, std::string_view str) {
+            results.emplace_back(id, std::string(str));
+        });
+        REQUIRE_EQ(results, expected);
+
+        expected.clear(), results.clear();
+        full.prefix_search(query, [&](std::uint64_t id, std::string_view str) {
+            expected.emplace_back(id, std::string(str));
+        });
+        trie.prefix_search(query, [&](std::uint64_t id, std::string_view str) {
+            results.emplace_back(id, std::string(str));
+        });
+        REQUIRE_EQ(results, expected);
+    }
+
+    std::uint64_t num_keys = 0;
+    trie.enumerate([&](std::uint64_t id, std::string_view str) {
+        REQUIRE_EQ(full.decode(id), str);
+        num_keys += 1;
+    });
+    REQUIRE_EQ(num_keys, keys.size());
+}
+
+void test_set(const set_type& trie, const std::vector<std::string>& keys, const std::vector<std::string>& others) {
+    REQUIRE_EQ(trie.num_keys(), keys.size());
+
+    for (auto& key : keys) {
+        REQUIRE(trie.contains(key));
+    }
+    for (auto& other : others) {
+        REQUIRE_FALSE(trie.contains(other));
+    }
+
+    for (std::uint64_t i = 0; i < std::min<std::uint64_t>(others.size(), 1000); i++) {
+        const auto& query = others[i];
+        {
+            const auto expected = xcdat::test::predictive_search_naive(keys, query.substr(0, 2));
+            std::vector<std::string> results;
+            auto itr = trie.make_predictive_iterator(query.substr(0, 2));
+            while (itr.next()) {
+                results.push_back(itr.decoded());
+            }
+            REQUIRE_EQ(results, expected);
+        }
+        {
+            const auto expected = xcdat::test::prefix_search_naive(keys, query);
+            std::vector<std::string> results;
+            auto itr = trie.make_prefix_iterator(query);
+            while (itr.next()) {
+                results.push_back(itr.decoded());
+            }
+            REQUIRE_EQ(results, expected);
+        }
+    }
+
+    std::vector<std::string> results;
+    auto itr = trie.make_enumerative_iterator();
+    while (itr.next()) {
+        results.push_back(itr.decoded());
+    }
+    REQUIRE_EQ(results, keys);
+}
+
+void test_fast_decode(const fast_decode_type& trie, const full_type& full, const std::vector<std::string>& keys) {
+    REQUIRE_EQ(trie.num_keys(), full.num_keys());
+
+    for (auto& key : keys) {
+        REQUIRE_EQ(trie.lookup(key).value(), full.lookup(key).value());
+    }
+
+    std::string decoded;
+    for (std::uint64_t id = 0; id < trie.num_keys(); id++) {
+        trie.decode(id, decoded);
+        REQUIRE_EQ(decoded, full.decode(id));
+    }
+    REQUIRE(trie.decode(trie.num_keys()).empty());
+}
+
+std::vector<std::pair<char, std::uint64_t>> child_histogram_naive(const std::vector<std::string>& keys,
+                                                                std::string_view query) {
+    std::array<std::uint64_t, 256> counts = {};
+    for (const auto& key : xcdat::test::predictive_search_naive(keys, query)) {
+        if (query.size() < key.size()) {
+            counts[static_cast<std::uint8_t>(key[query.size()])] += 1;
+        }
+    }
+    std::vector<std::pair<char, std::uint64_t>> histogram;
+    for (std::uint64_t c = 0; c < 256; c++) {
+        if (counts[c] != 0) {
+            histogram.emplace_back(static_cast<char>(c), counts[c]);
+        }
+    }
+    return histogram;
+}
+
+void test_counting(const counting_type& trie, const full_type& full, const std::vector<std::string>& keys,
+                   const std::vector<std::string>& others) {
+    REQUIRE_EQ(trie.count_prefix(""), keys.size());
+    REQUIRE_EQ(trie.child_histogram(""), child_histogram_naive(keys, ""));
+
+    for (std::uint64_t i = 0; i < keys.size(); i += std::max<std::uint64_t>(1, keys.size() / 1000)) {
+        REQUIRE_EQ(trie.decode(i), full.decode(i));
+    }
+
+    // The tasks of parallel enumeration are split with the counts.
+    std::vector<std::pair<std::uint64_t, std::string>> expected, results;
+    trie.enumerate([&](std::uint64_t id, std::string_view str) { expected.emplace_back(id, std::string(str)); });
+    trie.parallel_enumerate("", 3, [&](std::uint64_t id, std::string_view str) {
+        results.emplace_back(id, std::string(str));
+    });
+    REQUIRE_EQ(results, expected);
+
+    std::vector<std::string> queries;
+    for (std::uint64_t i = 0; i < std::min<std::uint64_t>(keys.size(), 300); i++) {
+        queries.push_back(keys[i]);
+        queries.push_back(others[i % others.size()]);
+    }
+    for (const auto& query : queries) {
+        for (std::uint64_t len = 0; len <= query.size(); len++) {
+            const auto prefix = std::string_view(query).substr(0, len);
+            REQUIRE_EQ(trie.count_prefix(prefix), xcdat::test::predictive_search_naive(keys, prefix).size());
+            REQUIRE_EQ(trie.child_histogram(prefix), child_histogram_naive(keys, prefix));
+        }
+    }
+}
+
+template <class Trie>
+void test_io(const Trie& trie, const std::vector<std::string>& keys) {
+    const char* tmp_filepath = "tmp.idx";
+
+    const std::uint64_t memory = xcdat::memory_in_bytes(trie);
+    REQUIRE_EQ(memory, xcdat::save(trie, tmp_filepath));
+
+    {
+        const auto loaded = xcdat::load<Trie>(tmp_filepath);
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(loaded));
+        for (auto& key : keys) {
+            REQUIRE(loaded.contains(key));
+        }
+    }
+
+    {
+        mm::file_source<char> fin(tmp_filepath, mm::advice::sequential);
+        const auto mapped = xcdat::mmap<Trie>(fin.data());
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(mapped));
+        for (auto& key : keys) {
+            REQUIRE(mapped.contains(key));
+        }
+    }
+
+    // The index cannot be opened with the other capabilities.
+    if constexpr (Trie::capability != xcdat::trie_capability::full) {
+        REQUIRE_THROWS_AS(xcdat::load<full_type>(tmp_filepath), const xcdat::exception&);
+    } else {
+        REQUIRE_THROWS_AS(xcdat::load<lookup_type>(tmp_filepath), const xcdat::exception&);
+        REQUIRE_THROWS_AS(xcdat::load<set_type>(tmp_filepath), const xcdat::exception&);
+    }
+
+    std::remove(tmp_filepath);
+}
+
+TEST_CASE("Test xcdat::trie capabilities (type_id)") {
+    REQUIRE_NE(full_type::type_id, lookup_type::type_id);
+    REQUIRE_NE(full_type::type_id, set_type::type_id);
+    REQUIRE_NE(lookup_type::type_id, set_type::type_id);
+    REQUIRE_NE(full_type::type_id, fast_decode_type::type_id);
+    REQUIRE_EQ(full_type::type_id, (xcdat::trie<xcdat::bc_vector_8>::type_id));
+}
+
+TEST_CASE("Test xcdat::trie capabilities (tiny)") {
+    std::vector<std::string> keys = {
+        "AirPods",  "AirTag",  "Mac",  "MacBook", "MacBook_Air", "MacBook_Pro",
+        "Mac_Mini", "Mac_Pro", "iMac", "iPad",    "iPhone",      "iPhone_SE",
+    };
+    std::vector<std::string> others = {"Google_Pixel", "Ma", "MacBook_", "iPhone_SE2"};
+
+    const full_type full(keys);
+    const lookup_type lookup(keys);
+    const set_type set(keys);
+
+    test_lookup(lookup, full, keys, others);
+    test_set(set, keys, others);
+    test_fast_decode(fast_decode_type(keys), full, keys);
+    test_counting(counting_type(keys), full, keys, others);
+}
+
+TEST_CASE("Test xcdat::trie capabilities (random 10K, A--B)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, 'A', 'B'));
+    auto others = xcdat::test::extract_keys(keys);
+
+    const full_type full(keys);
+    const lookup_type lookup(keys);
+    const set_type set(keys);
+
+    test_lookup(lookup, full, keys, others);
+    test_set(set, keys, others);
+
+    test_io(full, keys);
+    test_io(lookup, keys);
+    test_io(set, keys);
+
+    const fast_decode_type fast_decode(keys);
+    test_fast_decode(fast_decode, full, keys);
+    test_io(fast_decode, keys);
+
+    const counting_type counting(keys);
+    test_counting(counting, full, keys, others);
+    test_io(counting, keys);
+
+    // The dropped rank and select structures reduce the memory usage.
+    REQUIRE_LT(xcdat::memory_in_bytes(lookup), xcdat::memory_in_bytes(full));
+    REQUIRE_LT(xcdat::memory_in_bytes(set), xcdat::memory_in_bytes(lookup));
+}
+
+TEST_CASE("Test xcdat::trie capabilities (random 10K, 0x00--0xFF)") {
+    auto keys = xcdat::test::to_unique_vec(xcdat::test::make_random_keys(10000, 1, 30, INT8_MIN, INT8_MAX));
+    auto others = xcdat::test::extract_keys(keys);
+
+    const full_type full(keys);
+    const lookup_type lookup(keys);
+    const set_type set(keys);
+
+    test_lookup(lookup, full, keys, others);
+    test_set(set, keys, others);
+    test_io(set, keys);
+    test_fast_decode(fast_decode_type(keys), full, keys);
+    test_counting(counting_type(keys), full, keys, others);
+}
+
+TEST_CASE("Test xcdat::trie capabilities (real)") {
+    auto keys = xcdat::test::to_unique_vec(load_strings("keys.txt"));
+    auto others = xcdat::test::extract_keys(keys);
+
+    const full_type full(keys);
+    test_counting(counting_type(keys), full, keys, others);
+}
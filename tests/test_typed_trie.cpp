@@ -0,0 +1,146 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <array>
+#include <cstdio>
+
+#include "doctest/doctest.h"
+#include "mm_file/mm_file.hpp"
+#include "test_common.hpp"
+#include "xcdat.hpp"
+
+template <class Key>
+std::vector<Key> make_random_typed_keys(std::uint64_t n, std::uint64_t max, std::uint64_t seed = 13) {
+    std::vector<Key> keys;
+    for (const std::uint64_t x : xcdat::test::make_random_ints(n, 0, max, seed)) {
+        if constexpr (std::is_integral_v<Key>) {
+            keys.push_back(static_cast<Key>(x));
+        } else {
+            // Byte arrays whose first and last bytes vary, like IPv6 addresses of a few networks.
+            Key key = {};
+            key.front() = static_cast<std::uint8_t>(x >> 8);
+            key.back() = static_cast<std::uint8_t>(x);
+            keys.push_back(key);
+        }
+    }
+    return xcdat::test::to_unique_vec(std::move(keys));
+}
+
+template <class Trie>
+void test_typed_trie(const Trie& trie, const std::vector<typename Trie::key_type>& keys,
+                     const std::vector<typename Trie::key_type>& others) {
+    using key_type = typename Trie::key_type;
+
+    REQUIRE_EQ(trie.num_keys(), keys.size());
+
+    for (auto& key : keys) {
+        REQUIRE(trie.contains(key));
+        REQUIRE(trie.decode(trie.lookup(key).value()) == key);
+    }
+    for (auto& other : others) {
+        if (!std::binary_search(keys.begin(), keys.end(), other)) {
+            REQUIRE_FALSE(trie.contains(other));
+            REQUIRE_FALSE(trie.lookup(other).has_value());
+        }
+    }
+
+    {
+        std::vector<key_type> results;
+        trie.enumerate([&](std::uint64_t id, const key_type& key) {
+            REQUIRE(trie.decode(id) == key);
+            results.push_back(key);
+        });
+        REQUIRE(results == keys);
+
+        results.clear();
+        trie.enumerate([&](std::uint64_t, const key_type& key) { results.push_back(key); }, 10);
+        REQUIRE_EQ(results.size(), std::min<std::uint64_t>(keys.size(), 10));
+    }
+
+    for (std::uint64_t i = 0; i + 1 < std::min<std::uint64_t>(others.size(), 100); i++) {
+        const key_type lo = std::min(others[i], others[i + 1]);
+        const key_type hi = std::max(others[i], others[i + 1]);
+        const auto beg = std::lower_bound(keys.begin(), keys.end(), lo);
+        const auto end = std::upper_bound(keys.begin(), keys.end(), hi);
+
+        std::vector<key_type> results;
+        trie.range_search(lo, hi, [&](std::uint64_t id, const key_type& key) {
+            REQUIRE(trie.decode(id) == key);
+            results.push_back(key);
+        });
+        REQUIRE(results == std::vector<key_type>(beg, end));
+    }
+}
+
+template <class Trie>
+void test_io(const Trie& trie, const std::vector<typename Trie::key_type>& keys) {
+    const char* tmp_filepath = "tmp.idx";
+
+    const std::uint64_t memory = xcdat::memory_in_bytes(trie);
+    REQUIRE_EQ(memory, xcdat::save(trie, tmp_filepath));
+    REQUIRE_EQ(xcdat::get_type_id(tmp_filepath), Trie::type_id);
+
+    {
+        const auto loaded = xcdat::load<Trie>(tmp_filepath);
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(loaded));
+        for (auto& key : keys) {
+            REQUIRE(loaded.contains(key));
+        }
+    }
+    {
+        mm::file_source<char> fin(tmp_filepath, mm::advice::sequential);
+        const auto mapped = xcdat::mmap<Trie>(fin.data());
+        REQUIRE_EQ(memory, xcdat::memory_in_bytes(mapped));
+        for (auto& key : keys) {
+            REQUIRE(mapped.decode(mapped.lookup(key).value()) == key);
+        }
+    }
+
+    // The index cannot be opened with the other key types.
+    if constexpr (std::is_same_v<typename Trie::key_type, std::uint32_t>) {
+        REQUIRE_THROWS_AS(xcdat::load<xcdat::typed_trie_8_type<std::uint64_t>>(tmp_filepath),
+                          const xcdat::exception&);
+    } else {
+        REQUIRE_THROWS_AS(xcdat::load<xcdat::typed_trie_8_type<std::uint32_t>>(tmp_filepath),
+                          const xcdat::exception&);
+    }
+
+    std::remove(tmp_filepath);
+}
+
+TEST_CASE("Test xcdat::typed_trie (tiny)") {
+    const std::vector<std::uint32_t> keys = {0, 1, 255, 256, 65535, 65536, 16777216, 4294967295};
+    const xcdat::typed_trie_8_type<std::uint32_t> trie(keys);
+    REQUIRE(trie.bin_mode());
+
+    test_typed_trie(trie, keys, {2, 254, 257, 65537, 4294967294});
+    test_io(trie, keys);
+
+    std::vector<std::uint32_t> results;
+    trie.range_search(200, 70000, [&](std::uint64_t, std::uint32_t key) { results.push_back(key); });
+    REQUIRE_EQ(results, std::vector<std::uint32_t>{255, 256, 65535, 65536});
+}
+
+TEST_CASE("Test xcdat::typed_trie (random 10K, uint32_t)") {
+    const auto keys = make_random_typed_keys<std::uint32_t>(10000, UINT32_MAX);
+    const auto others = make_random_typed_keys<std::uint32_t>(1000, UINT32_MAX, 17);
+    const xcdat::typed_trie_8_type<std::uint32_t> trie(keys);
+    test_typed_trie(trie, keys, others);
+    test_io(trie, keys);
+}
+
+TEST_CASE("Test xcdat::typed_trie (random 10K, uint64_t)") {
+    const auto keys = make_random_typed_keys<std::uint64_t>(10000, 1ULL << 40);
+    const auto others = make_random_typed_keys<std::uint64_t>(1000, 1ULL << 40, 17);
+    const xcdat::typed_trie_16_type<std::uint64_t> trie(keys);
+    test_typed_trie(trie, keys, others);
+    test_io(trie, keys);
+}
+
+TEST_CASE("Test xcdat::typed_trie (random 10K, std::array<std::uint8_t, 16>)") {
+    using key_type = std::array<std::uint8_t, 16>;
+    const auto keys = make_random_typed_keys<key_type>(10000, UINT16_MAX);
+    const auto others = make_random_typed_keys<key_type>(1000, UINT16_MAX, 17);
+    const xcdat::typed_trie_7_type<key_type> trie(keys);
+    test_typed_trie(trie, keys, others);
+    test_io(trie, keys);
+}
@@ -14,6 +14,13 @@ cmd_line_parser::parser make_parser(int argc, char** argv) {
     p.add("num_samples", "Number of sample keys for searches (default=1000)", "-n", false);
     p.add("random_seed", "Random seed for sampling (default=13)", "-s", false);
     p.add("binary_mode", "Is binary mode? (default=0)", "-b", false);
+    p.add("tail_type", "TAIL type: [plain|repair|nested] (default=plain)", "-c", false);
+    p.add("utf8_mode", "Are transitions labeled with UTF-8 characters? (default=0)", "-u", false);
+    p.add("encoded_mode", "Are keywords encoded in the order-preserving way? (default=0)", "-e", false);
+    p.add("dawg_mode", "Are equivalent subtrees merged into a minimal automaton? (default=0)", "-d", false);
+    p.add("louds_mode", "Is the LOUDS trie compared with the double-array trie? (default=0)", "-l", false);
+    p.add("fc_mode", "Is the trie with front-coded keywords compared? (default=0)", "-k", false);
+    p.add("fast_decode", "Is the trie with the ID-to-node array compared with select? (default=0)", "-f", false);
     return p;
 }
 
@@ -60,6 +67,8 @@ Trie benchmark_build(const std::vector<std::string>& keys, bool binary_mode) {
     const double memory_in_bytes = xcdat::memory_in_bytes(trie);
 
     tfm::printfln("Number of keys: %d", trie.num_keys());
+    tfm::printfln("Number of trie nodes: %d", trie.num_nodes());
+    tfm::printfln("Length of TAIL vector: %d", trie.tail_length());
     tfm::printfln("Memory usage in bytes: %d", memory_in_bytes);
     tfm::printfln("Memory usage in MiB: %g", memory_in_bytes / (1024.0 * 1024.0));
     tfm::printfln("Construction time in seconds: %g", time_in_sec);
@@ -137,6 +146,13 @@ int main(int argc, char** argv) {
     const auto num_samples = p.get<std::uint64_t>("num_samples", 1000);
     const auto random_seed = p.get<std::uint64_t>("random_seed", 13);
     const auto binary_mode = p.get<bool>("binary_mode", false);
+    const auto tail_type = p.get<std::string>("tail_type", "plain");
+    const auto utf8_mode = p.get<bool>("utf8_mode", false);
+    const auto encoded_mode = p.get<bool>("encoded_mode", false);
+    const auto dawg_mode = p.get<bool>("dawg_mode", false);
+    const auto louds_mode = p.get<bool>("louds_mode", false);
+    const auto fast_decode = p.get<bool>("fast_decode", false);
+    const auto fc_mode = p.get<bool>("fc_mode", false);
 
     auto keys = load_strings(input_keys);
     if (keys.empty()) {
@@ -149,17 +165,124 @@ int main(int argc, char** argv) {
 
     const auto query_keys = sample_keys(keys, num_samples, random_seed);
 
-    tfm::printfln("** xcdat::trie_7_type **");
-    benchmark<xcdat::trie_7_type>(keys, query_keys, binary_mode);
+    if (fc_mode && tail_type == "plain") {
+        tfm::printfln("** xcdat::trie_8_type **");
+        benchmark<xcdat::trie_8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_8_fc_type **");
+        benchmark<xcdat::trie_8_fc_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_type **");
+        benchmark<xcdat::trie_16_type>(keys, query_keys, binary_mode);
 
-    tfm::printfln("** xcdat::trie_8_type **");
-    benchmark<xcdat::trie_8_type>(keys, query_keys, binary_mode);
-
-    tfm::printfln("** xcdat::trie_15_type **");
-    benchmark<xcdat::trie_15_type>(keys, query_keys, binary_mode);
-
-    tfm::printfln("** xcdat::trie_16_type **");
-    benchmark<xcdat::trie_16_type>(keys, query_keys, binary_mode);
+        tfm::printfln("** xcdat::trie_16_fc_type **");
+        benchmark<xcdat::trie_16_fc_type>(keys, query_keys, binary_mode);
+    } else if (fast_decode && tail_type == "plain") {
+        tfm::printfln("** xcdat::trie_8_type **");
+        benchmark<xcdat::trie_8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_8_fast_decode_type **");
+        benchmark<xcdat::trie_8_fast_decode_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_type **");
+        benchmark<xcdat::trie_16_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_fast_decode_type **");
+        benchmark<xcdat::trie_16_fast_decode_type>(keys, query_keys, binary_mode);
+    } else if (louds_mode && tail_type == "plain") {
+        tfm::printfln("** xcdat::trie_8_type **");
+        benchmark<xcdat::trie_8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::louds_trie_type **");
+        benchmark<xcdat::louds_trie_type>(keys, query_keys, binary_mode);
+    } else if (louds_mode && tail_type == "repair") {
+        tfm::printfln("** xcdat::trie_8_repair_type **");
+        benchmark<xcdat::trie_8_repair_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::louds_trie_repair_type **");
+        benchmark<xcdat::louds_trie_repair_type>(keys, query_keys, binary_mode);
+    } else if (louds_mode && tail_type == "nested") {
+        tfm::printfln("** xcdat::trie_8_nested_type **");
+        benchmark<xcdat::trie_8_nested_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::louds_trie_nested_type **");
+        benchmark<xcdat::louds_trie_nested_type>(keys, query_keys, binary_mode);
+    } else if (dawg_mode) {
+        tfm::printfln("** xcdat::dawg_7_type **");
+        benchmark<xcdat::dawg_7_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::dawg_8_type **");
+        benchmark<xcdat::dawg_8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::dawg_15_type **");
+        benchmark<xcdat::dawg_15_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::dawg_16_type **");
+        benchmark<xcdat::dawg_16_type>(keys, query_keys, binary_mode);
+    } else if (encoded_mode) {
+        tfm::printfln("** xcdat::trie_7_encoded_type **");
+        benchmark<xcdat::trie_7_encoded_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_8_encoded_type **");
+        benchmark<xcdat::trie_8_encoded_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_15_encoded_type **");
+        benchmark<xcdat::trie_15_encoded_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_encoded_type **");
+        benchmark<xcdat::trie_16_encoded_type>(keys, query_keys, binary_mode);
+    } else if (utf8_mode) {
+        tfm::printfln("** xcdat::trie_7_utf8_type **");
+        benchmark<xcdat::trie_7_utf8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_8_utf8_type **");
+        benchmark<xcdat::trie_8_utf8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_15_utf8_type **");
+        benchmark<xcdat::trie_15_utf8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_utf8_type **");
+        benchmark<xcdat::trie_16_utf8_type>(keys, query_keys, binary_mode);
+    } else if (tail_type == "plain") {
+        tfm::printfln("** xcdat::trie_7_type **");
+        benchmark<xcdat::trie_7_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_8_type **");
+        benchmark<xcdat::trie_8_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_15_type **");
+        benchmark<xcdat::trie_15_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_type **");
+        benchmark<xcdat::trie_16_type>(keys, query_keys, binary_mode);
+    } else if (tail_type == "repair") {
+        tfm::printfln("** xcdat::trie_7_repair_type **");
+        benchmark<xcdat::trie_7_repair_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_8_repair_type **");
+        benchmark<xcdat::trie_8_repair_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_15_repair_type **");
+        benchmark<xcdat::trie_15_repair_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_repair_type **");
+        benchmark<xcdat::trie_16_repair_type>(keys, query_keys, binary_mode);
+    } else if (tail_type == "nested") {
+        tfm::printfln("** xcdat::trie_7_nested_type **");
+        benchmark<xcdat::trie_7_nested_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_8_nested_type **");
+        benchmark<xcdat::trie_8_nested_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_15_nested_type **");
+        benchmark<xcdat::trie_15_nested_type>(keys, query_keys, binary_mode);
+
+        tfm::printfln("** xcdat::trie_16_nested_type **");
+        benchmark<xcdat::trie_16_nested_type>(keys, query_keys, binary_mode);
+    } else {
+        p.help();
+        return 1;
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -8,7 +8,16 @@ cmd_line_parser::parser make_parser(int argc, char** argv) {
     p.add("input_keys", "Input filepath of keywords");
     p.add("output_dic", "Output filepath of trie dictionary");
     p.add("trie_type", "Trie type: [7|8|15|16] (default=8)", "-t", false);
+    p.add("tail_type", "TAIL type: [plain|repair|nested] (default=plain)", "-c", false);
     p.add("binary_mode", "Is binary mode? (default=0)", "-b", false);
+    p.add("utf8_mode", "Are transitions labeled with UTF-8 characters? (default=0)", "-u", false);
+    p.add("encoded_mode", "Are keywords encoded in the order-preserving way? (default=0)", "-e", false);
+    p.add("dawg_mode", "Are equivalent subtrees merged into a minimal automaton? (default=0)", "-d", false);
+    p.add("louds_mode", "Is the trie represented in the succinct LOUDS format? (default=0)", "-l", false);
+    p.add("fc_mode", "Is a front-coded copy of keywords stored for fast decode? (default=0)", "-k", false);
+    p.add("suffix_mode", "Is a trie of reversed keywords stored for suffix search? (default=0)", "-s", false);
+    p.add("infix_mode", "Is a q-gram index stored for substring search? (default=0)", "-g", false);
+    p.add("capability", "Supported queries: [full|lookup|set|fast_decode|counting] (default=full)", "-m", false);
     return p;
 }
 
@@ -43,6 +52,7 @@ int build(const cmd_line_parser::parser& p) {
     tfm::printfln("Number of keys: %d", trie.num_keys());
     tfm::printfln("Number of trie nodes: %d", trie.num_nodes());
     tfm::printfln("Number of DA units: %d", trie.num_units());
+    tfm::printfln("Length of TAIL vector: %d", trie.tail_length());
     tfm::printfln("Memory usage in bytes: %d", memory_in_bytes);
     tfm::printfln("Memory usage in MiB: %g", memory_in_bytes / (1024.0 * 1024.0));
 
@@ -63,18 +73,217 @@ int main(int argc, char** argv) {
     }
 
     const auto trie_type = p.get<int>("trie_type", 8);
+    const auto tail_type = p.get<std::string>("tail_type", "plain");
+    const auto utf8_mode = p.get<bool>("utf8_mode", false);
+    const auto encoded_mode = p.get<bool>("encoded_mode", false);
+    const auto dawg_mode = p.get<bool>("dawg_mode", false);
+    const auto louds_mode = p.get<bool>("louds_mode", false);
+    const auto fc_mode = p.get<bool>("fc_mode", false);
+    const auto suffix_mode = p.get<bool>("suffix_mode", false);
+    const auto infix_mode = p.get<bool>("infix_mode", false);
+    const auto capability = p.get<std::string>("capability", "full");
 
-    switch (trie_type) {
-        case 7:
-            return build<xcdat::trie_7_type>(p);
-        case 8:
-            return build<xcdat::trie_8_type>(p);
-        case 15:
-            return build<xcdat::trie_15_type>(p);
-        case 16:
-            return build<xcdat::trie_16_type>(p);
-        default:
-            break;
+    if (suffix_mode) {
+        // The reversal splits multibyte characters, so UTF-8 transitions are not supported.
+        if (tail_type == "plain" && capability == "full" && !utf8_mode && !encoded_mode && !dawg_mode && !louds_mode &&
+            !fc_mode) {
+            switch (trie_type) {
+                case 7:
+                    return build<xcdat::trie_7_suffix_type>(p);
+                case 8:
+                    return build<xcdat::trie_8_suffix_type>(p);
+                case 15:
+                    return build<xcdat::trie_15_suffix_type>(p);
+                case 16:
+                    return build<xcdat::trie_16_suffix_type>(p);
+                default:
+                    break;
+            }
+        }
+    } else if (infix_mode) {
+        if (tail_type == "plain" && capability == "full" && !utf8_mode && !encoded_mode && !dawg_mode && !louds_mode &&
+            !fc_mode) {
+            switch (trie_type) {
+                case 7:
+                    return build<xcdat::trie_7_infix_type>(p);
+                case 8:
+                    return build<xcdat::trie_8_infix_type>(p);
+                case 15:
+                    return build<xcdat::trie_15_infix_type>(p);
+                case 16:
+                    return build<xcdat::trie_16_infix_type>(p);
+                default:
+                    break;
+            }
+        }
+    } else if (fc_mode) {
+        // The underlying trie is lookup-only since decode uses the front-coded keywords.
+        if (tail_type == "plain" && capability == "full" && !utf8_mode && !encoded_mode && !dawg_mode && !louds_mode) {
+            switch (trie_type) {
+                case 7:
+                    return build<xcdat::trie_7_fc_type>(p);
+                case 8:
+                    return build<xcdat::trie_8_fc_type>(p);
+                case 15:
+                    return build<xcdat::trie_15_fc_type>(p);
+                case 16:
+                    return build<xcdat::trie_16_fc_type>(p);
+                default:
+                    break;
+            }
+        }
+    } else if (capability != "full") {
+        // Only the plain double-array tries support the capabilities.
+        if (tail_type == "plain" && !utf8_mode && !encoded_mode && !dawg_mode && !louds_mode) {
+            if (capability == "lookup") {
+                switch (trie_type) {
+                    case 7:
+                        return build<xcdat::trie_7_lookup_type>(p);
+                    case 8:
+                        return build<xcdat::trie_8_lookup_type>(p);
+                    case 15:
+                        return build<xcdat::trie_15_lookup_type>(p);
+                    case 16:
+                        return build<xcdat::trie_16_lookup_type>(p);
+                    default:
+                        break;
+                }
+            } else if (capability == "set") {
+                switch (trie_type) {
+                    case 7:
+                        return build<xcdat::trie_7_set_type>(p);
+                    case 8:
+                        return build<xcdat::trie_8_set_type>(p);
+                    case 15:
+                        return build<xcdat::trie_15_set_type>(p);
+                    case 16:
+                        return build<xcdat::trie_16_set_type>(p);
+                    default:
+                        break;
+                }
+            } else if (capability == "fast_decode") {
+                switch (trie_type) {
+                    case 7:
+                        return build<xcdat::trie_7_fast_decode_type>(p);
+                    case 8:
+                        return build<xcdat::trie_8_fast_decode_type>(p);
+                    case 15:
+                        return build<xcdat::trie_15_fast_decode_type>(p);
+                    case 16:
+                        return build<xcdat::trie_16_fast_decode_type>(p);
+                    default:
+                        break;
+                }
+            } else if (capability == "counting") {
+                switch (trie_type) {
+                    case 7:
+                        return build<xcdat::trie_7_counting_type>(p);
+                    case 8:
+                        return build<xcdat::trie_8_counting_type>(p);
+                    case 15:
+                        return build<xcdat::trie_15_counting_type>(p);
+                    case 16:
+                        return build<xcdat::trie_16_counting_type>(p);
+                    default:
+                        break;
+                }
+            }
+        }
+    } else if (louds_mode) {
+        // The trie type is ignored since no DACs are used.
+        if (!utf8_mode && !encoded_mode && !dawg_mode) {
+            if (tail_type == "plain") {
+                return build<xcdat::louds_trie_type>(p);
+            } else if (tail_type == "repair") {
+                return build<xcdat::louds_trie_repair_type>(p);
+            } else if (tail_type == "nested") {
+                return build<xcdat::louds_trie_nested_type>(p);
+            }
+        }
+    } else if (dawg_mode) {
+        if (tail_type == "plain" && !utf8_mode && !encoded_mode) {
+            switch (trie_type) {
+                case 7:
+                    return build<xcdat::dawg_7_type>(p);
+                case 8:
+                    return build<xcdat::dawg_8_type>(p);
+                case 15:
+                    return build<xcdat::dawg_15_type>(p);
+                case 16:
+                    return build<xcdat::dawg_16_type>(p);
+                default:
+                    break;
+            }
+        }
+    } else if (encoded_mode) {
+        if (tail_type == "plain" && !utf8_mode) {
+            switch (trie_type) {
+                case 7:
+                    return build<xcdat::trie_7_encoded_type>(p);
+                case 8:
+                    return build<xcdat::trie_8_encoded_type>(p);
+                case 15:
+                    return build<xcdat::trie_15_encoded_type>(p);
+                case 16:
+                    return build<xcdat::trie_16_encoded_type>(p);
+                default:
+                    break;
+            }
+        }
+    } else if (utf8_mode) {
+        if (tail_type == "plain") {
+            switch (trie_type) {
+                case 7:
+                    return build<xcdat::trie_7_utf8_type>(p);
+                case 8:
+                    return build<xcdat::trie_8_utf8_type>(p);
+                case 15:
+                    return build<xcdat::trie_15_utf8_type>(p);
+                case 16:
+                    return build<xcdat::trie_16_utf8_type>(p);
+                default:
+                    break;
+            }
+        }
+    } else if (tail_type == "plain") {
+        switch (trie_type) {
+            case 7:
+                return build<xcdat::trie_7_type>(p);
+            case 8:
+                return build<xcdat::trie_8_type>(p);
+            case 15:
+                return build<xcdat::trie_15_type>(p);
+            case 16:
+                return build<xcdat::trie_16_type>(p);
+            default:
+                break;
+        }
+    } else if (tail_type == "repair") {
+        switch (trie_type) {
+            case 7:
+                return build<xcdat::trie_7_repair_type>(p);
+            case 8:
+                return build<xcdat::trie_8_repair_type>(p);
+            case 15:
+                return build<xcdat::trie_15_repair_type>(p);
+            case 16:
+                return build<xcdat::trie_16_repair_type>(p);
+            default:
+                break;
+        }
+    } else if (tail_type == "nested") {
+        switch (trie_type) {
+            case 7:
+                return build<xcdat::trie_7_nested_type>(p);
+            case 8:
+                return build<xcdat::trie_8_nested_type>(p);
+            case 15:
+                return build<xcdat::trie_15_nested_type>(p);
+            case 16:
+                return build<xcdat::trie_16_nested_type>(p);
+            default:
+                break;
+        }
     }
 
     p.help();
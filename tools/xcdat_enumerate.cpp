@@ -1,3 +1,5 @@
+#include <mutex>
+
 #include <xcdat.hpp>
 
 #include "cmd_line_parser/parser.hpp"
@@ -7,16 +9,43 @@
 cmd_line_parser::parser make_parser(int argc, char** argv) {
     cmd_line_parser::parser p(argc, argv);
     p.add("input_dic", "Input filepath of trie dictionary");
+    p.add("num_threads", "The number of worker threads (default=1)", "-t", false);
+    p.add("unordered", "Are the keywords printed in an arbitrary order with the threads? (default=0)", "-u", false);
     return p;
 }
 
+// Whether the dictionary can be enumerated with worker threads.
+template <class Trie, class = void>
+struct has_parallel_enumerate : std::false_type {};
+
+template <class Trie>
+struct has_parallel_enumerate<Trie, std::void_t<decltype(std::declval<const Trie&>().parallel_enumerate(
+                                        "", 1, std::function<void(std::uint64_t, std::string_view)>()))>>
+    : std::true_type {};
+
 template <class Trie>
 int enumerate(const cmd_line_parser::parser& p) {
     const auto input_dic = p.get<std::string>("input_dic");
+    const auto num_threads = p.get<std::uint64_t>("num_threads", 1);
+    const auto unordered = p.get<bool>("unordered", false);
 
     const mm::file_source<char> fin(input_dic.c_str(), mm::advice::sequential);
     const auto trie = xcdat::mmap<Trie>(fin.data());
 
+    if constexpr (has_parallel_enumerate<Trie>::value) {
+        if (1 < num_threads) {
+            std::mutex mtx;
+            trie.parallel_enumerate(
+                "", num_threads,
+                [&](std::uint64_t id, std::string_view str) {
+                    std::lock_guard<std::mutex> lock(mtx);  // only needed in the unordered mode
+                    tfm::printfln("%d\t%s", id, str);
+                },
+                !unordered);
+            return 0;
+        }
+    }
+
     trie.enumerate([&](std::uint64_t id, std::string_view str) { tfm::printfln("%d\t%s", id, str); });
 
     return 0;
@@ -45,6 +74,100 @@ int main(int argc, char** argv) {
             return enumerate<xcdat::trie_15_type>(p);
         case 16:
             return enumerate<xcdat::trie_16_type>(p);
+        case xcdat::trie_7_repair_type::type_id:
+            return enumerate<xcdat::trie_7_repair_type>(p);
+        case xcdat::trie_8_repair_type::type_id:
+            return enumerate<xcdat::trie_8_repair_type>(p);
+        case xcdat::trie_15_repair_type::type_id:
+            return enumerate<xcdat::trie_15_repair_type>(p);
+        case xcdat::trie_16_repair_type::type_id:
+            return enumerate<xcdat::trie_16_repair_type>(p);
+        case xcdat::trie_7_nested_type::type_id:
+            return enumerate<xcdat::trie_7_nested_type>(p);
+        case xcdat::trie_8_nested_type::type_id:
+            return enumerate<xcdat::trie_8_nested_type>(p);
+        case xcdat::trie_15_nested_type::type_id:
+            return enumerate<xcdat::trie_15_nested_type>(p);
+        case xcdat::trie_16_nested_type::type_id:
+            return enumerate<xcdat::trie_16_nested_type>(p);
+        case xcdat::trie_7_utf8_type::type_id:
+            return enumerate<xcdat::trie_7_utf8_type>(p);
+        case xcdat::trie_8_utf8_type::type_id:
+            return enumerate<xcdat::trie_8_utf8_type>(p);
+        case xcdat::trie_15_utf8_type::type_id:
+            return enumerate<xcdat::trie_15_utf8_type>(p);
+        case xcdat::trie_16_utf8_type::type_id:
+            return enumerate<xcdat::trie_16_utf8_type>(p);
+        case xcdat::trie_7_encoded_type::type_id:
+            return enumerate<xcdat::trie_7_encoded_type>(p);
+        case xcdat::trie_8_encoded_type::type_id:
+            return enumerate<xcdat::trie_8_encoded_type>(p);
+        case xcdat::trie_15_encoded_type::type_id:
+            return enumerate<xcdat::trie_15_encoded_type>(p);
+        case xcdat::trie_16_encoded_type::type_id:
+            return enumerate<xcdat::trie_16_encoded_type>(p);
+        case xcdat::dawg_7_type::type_id:
+            return enumerate<xcdat::dawg_7_type>(p);
+        case xcdat::dawg_8_type::type_id:
+            return enumerate<xcdat::dawg_8_type>(p);
+        case xcdat::dawg_15_type::type_id:
+            return enumerate<xcdat::dawg_15_type>(p);
+        case xcdat::dawg_16_type::type_id:
+            return enumerate<xcdat::dawg_16_type>(p);
+        case xcdat::trie_7_lookup_type::type_id:
+            return enumerate<xcdat::trie_7_lookup_type>(p);
+        case xcdat::trie_8_lookup_type::type_id:
+            return enumerate<xcdat::trie_8_lookup_type>(p);
+        case xcdat::trie_15_lookup_type::type_id:
+            return enumerate<xcdat::trie_15_lookup_type>(p);
+        case xcdat::trie_16_lookup_type::type_id:
+            return enumerate<xcdat::trie_16_lookup_type>(p);
+        case xcdat::trie_7_fast_decode_type::type_id:
+            return enumerate<xcdat::trie_7_fast_decode_type>(p);
+        case xcdat::trie_8_fast_decode_type::type_id:
+            return enumerate<xcdat::trie_8_fast_decode_type>(p);
+        case xcdat::trie_15_fast_decode_type::type_id:
+            return enumerate<xcdat::trie_15_fast_decode_type>(p);
+        case xcdat::trie_16_fast_decode_type::type_id:
+            return enumerate<xcdat::trie_16_fast_decode_type>(p);
+        case xcdat::trie_7_fc_type::type_id:
+            return enumerate<xcdat::trie_7_fc_type>(p);
+        case xcdat::trie_8_fc_type::type_id:
+            return enumerate<xcdat::trie_8_fc_type>(p);
+        case xcdat::trie_15_fc_type::type_id:
+            return enumerate<xcdat::trie_15_fc_type>(p);
+        case xcdat::trie_16_fc_type::type_id:
+            return enumerate<xcdat::trie_16_fc_type>(p);
+        case xcdat::trie_7_suffix_type::type_id:
+            return enumerate<xcdat::trie_7_suffix_type>(p);
+        case xcdat::trie_8_suffix_type::type_id:
+            return enumerate<xcdat::trie_8_suffix_type>(p);
+        case xcdat::trie_15_suffix_type::type_id:
+            return enumerate<xcdat::trie_15_suffix_type>(p);
+        case xcdat::trie_16_suffix_type::type_id:
+            return enumerate<xcdat::trie_16_suffix_type>(p);
+        case xcdat::trie_7_infix_type::type_id:
+            return enumerate<xcdat::trie_7_infix_type>(p);
+        case xcdat::trie_8_infix_type::type_id:
+            return enumerate<xcdat::trie_8_infix_type>(p);
+        case xcdat::trie_15_infix_type::type_id:
+            return enumerate<xcdat::trie_15_infix_type>(p);
+        case xcdat::trie_16_infix_type::type_id:
+            return enumerate<xcdat::trie_16_infix_type>(p);
+        case xcdat::trie_7_counting_type::type_id:
+            return enumerate<xcdat::trie_7_counting_type>(p);
+        case xcdat::trie_8_counting_type::type_id:
+            return enumerate<xcdat::trie_8_counting_type>(p);
+        case xcdat::trie_15_counting_type::type_id:
+            return enumerate<xcdat::trie_15_counting_type>(p);
+        case xcdat::trie_16_counting_type::type_id:
+            return enumerate<xcdat::trie_16_counting_type>(p);
+        case xcdat::louds_trie_type::type_id:
+            return enumerate<xcdat::louds_trie_type>(p);
+        case xcdat::louds_trie_repair_type::type_id:
+            return enumerate<xcdat::louds_trie_repair_type>(p);
+        case xcdat::louds_trie_nested_type::type_id:
+            return enumerate<xcdat::louds_trie_nested_type>(p);
         default:
             break;
     }
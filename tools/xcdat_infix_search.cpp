@@ -0,0 +1,71 @@
+#include <xcdat.hpp>
+
+#include "cmd_line_parser/parser.hpp"
+#include "mm_file/mm_file.hpp"
+#include "tinyformat/tinyformat.h"
+
+cmd_line_parser::parser make_parser(int argc, char** argv) {
+    cmd_line_parser::parser p(argc, argv);
+    p.add("input_dic", "Input filepath of trie dictionary built with -g 1");
+    p.add("max_num_results", "The max number of results (default=10)", "-n", false);
+    return p;
+}
+
+template <class Trie>
+int infix_search(const cmd_line_parser::parser& p) {
+    const auto input_dic = p.get<std::string>("input_dic");
+    const auto max_num_results = p.get<std::uint64_t>("max_num_results", 10);
+
+    const mm::file_source<char> fin(input_dic.c_str(), mm::advice::sequential);
+    const auto trie = xcdat::mmap<Trie>(fin.data());
+
+    struct result_type {
+        std::uint64_t id;
+        std::string str;
+    };
+    std::vector<result_type> results;
+
+    for (std::string key; std::getline(std::cin, key);) {
+        results.clear();
+        trie.infix_search(
+            key, [&](std::uint64_t id, std::string_view str) { results.push_back({id, std::string(str)}); },
+            max_num_results);
+        tfm::printfln("%d found", results.size());
+        for (const auto& r : results) {
+            tfm::printfln("%d\t%s", r.id, r.str);
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv) {
+#ifndef NDEBUG
+    tfm::warnfln("The code is running in debug mode.");
+#endif
+    std::ios::sync_with_stdio(false);
+
+    auto p = make_parser(argc, argv);
+    if (!p.parse()) {
+        return 1;
+    }
+
+    const auto input_dic = p.get<std::string>("input_dic");
+    const auto type_id = xcdat::get_type_id(input_dic);
+
+    switch (type_id) {
+        case xcdat::trie_7_infix_type::type_id:
+            return infix_search<xcdat::trie_7_infix_type>(p);
+        case xcdat::trie_8_infix_type::type_id:
+            return infix_search<xcdat::trie_8_infix_type>(p);
+        case xcdat::trie_15_infix_type::type_id:
+            return infix_search<xcdat::trie_15_infix_type>(p);
+        case xcdat::trie_16_infix_type::type_id:
+            return infix_search<xcdat::trie_16_infix_type>(p);
+        default:
+            break;
+    }
+
+    p.help();
+    return 1;
+}
\ No newline at end of file
@@ -29,6 +29,21 @@ int lookup(const cmd_line_parser::parser& p) {
     return 0;
 }
 
+// For the set-only tries without IDs, 1 is printed for a stored keyword instead.
+template <class Trie>
+int contains(const cmd_line_parser::parser& p) {
+    const auto input_dic = p.get<std::string>("input_dic");
+
+    const mm::file_source<char> fin(input_dic.c_str(), mm::advice::sequential);
+    const auto trie = xcdat::mmap<Trie>(fin.data());
+
+    for (std::string str; std::getline(std::cin, str);) {
+        tfm::printfln("%d\t%s", trie.contains(str) ? 1 : -1, str);
+    }
+
+    return 0;
+}
+
 int main(int argc, char** argv) {
 #ifndef NDEBUG
     tfm::warnfln("The code is running in debug mode.");
@@ -52,6 +67,108 @@ int main(int argc, char** argv) {
             return lookup<xcdat::trie_15_type>(p);
         case 16:
             return lookup<xcdat::trie_16_type>(p);
+        case xcdat::trie_7_repair_type::type_id:
+            return lookup<xcdat::trie_7_repair_type>(p);
+        case xcdat::trie_8_repair_type::type_id:
+            return lookup<xcdat::trie_8_repair_type>(p);
+        case xcdat::trie_15_repair_type::type_id:
+            return lookup<xcdat::trie_15_repair_type>(p);
+        case xcdat::trie_16_repair_type::type_id:
+            return lookup<xcdat::trie_16_repair_type>(p);
+        case xcdat::trie_7_nested_type::type_id:
+            return lookup<xcdat::trie_7_nested_type>(p);
+        case xcdat::trie_8_nested_type::type_id:
+            return lookup<xcdat::trie_8_nested_type>(p);
+        case xcdat::trie_15_nested_type::type_id:
+            return lookup<xcdat::trie_15_nested_type>(p);
+        case xcdat::trie_16_nested_type::type_id:
+            return lookup<xcdat::trie_16_nested_type>(p);
+        case xcdat::trie_7_utf8_type::type_id:
+            return lookup<xcdat::trie_7_utf8_type>(p);
+        case xcdat::trie_8_utf8_type::type_id:
+            return lookup<xcdat::trie_8_utf8_type>(p);
+        case xcdat::trie_15_utf8_type::type_id:
+            return lookup<xcdat::trie_15_utf8_type>(p);
+        case xcdat::trie_16_utf8_type::type_id:
+            return lookup<xcdat::trie_16_utf8_type>(p);
+        case xcdat::trie_7_encoded_type::type_id:
+            return lookup<xcdat::trie_7_encoded_type>(p);
+        case xcdat::trie_8_encoded_type::type_id:
+            return lookup<xcdat::trie_8_encoded_type>(p);
+        case xcdat::trie_15_encoded_type::type_id:
+            return lookup<xcdat::trie_15_encoded_type>(p);
+        case xcdat::trie_16_encoded_type::type_id:
+            return lookup<xcdat::trie_16_encoded_type>(p);
+        case xcdat::dawg_7_type::type_id:
+            return lookup<xcdat::dawg_7_type>(p);
+        case xcdat::dawg_8_type::type_id:
+            return lookup<xcdat::dawg_8_type>(p);
+        case xcdat::dawg_15_type::type_id:
+            return lookup<xcdat::dawg_15_type>(p);
+        case xcdat::dawg_16_type::type_id:
+            return lookup<xcdat::dawg_16_type>(p);
+        case xcdat::trie_7_lookup_type::type_id:
+            return lookup<xcdat::trie_7_lookup_type>(p);
+        case xcdat::trie_8_lookup_type::type_id:
+            return lookup<xcdat::trie_8_lookup_type>(p);
+        case xcdat::trie_15_lookup_type::type_id:
+            return lookup<xcdat::trie_15_lookup_type>(p);
+        case xcdat::trie_16_lookup_type::type_id:
+            return lookup<xcdat::trie_16_lookup_type>(p);
+        case xcdat::trie_7_set_type::type_id:
+            return contains<xcdat::trie_7_set_type>(p);
+        case xcdat::trie_8_set_type::type_id:
+            return contains<xcdat::trie_8_set_type>(p);
+        case xcdat::trie_15_set_type::type_id:
+            return contains<xcdat::trie_15_set_type>(p);
+        case xcdat::trie_16_set_type::type_id:
+            return contains<xcdat::trie_16_set_type>(p);
+        case xcdat::trie_7_fast_decode_type::type_id:
+            return lookup<xcdat::trie_7_fast_decode_type>(p);
+        case xcdat::trie_8_fast_decode_type::type_id:
+            return lookup<xcdat::trie_8_fast_decode_type>(p);
+        case xcdat::trie_15_fast_decode_type::type_id:
+            return lookup<xcdat::trie_15_fast_decode_type>(p);
+        case xcdat::trie_16_fast_decode_type::type_id:
+            return lookup<xcdat::trie_16_fast_decode_type>(p);
+        case xcdat::trie_7_fc_type::type_id:
+            return lookup<xcdat::trie_7_fc_type>(p);
+        case xcdat::trie_8_fc_type::type_id:
+            return lookup<xcdat::trie_8_fc_type>(p);
+        case xcdat::trie_15_fc_type::type_id:
+            return lookup<xcdat::trie_15_fc_type>(p);
+        case xcdat::trie_16_fc_type::type_id:
+            return lookup<xcdat::trie_16_fc_type>(p);
+        case xcdat::trie_7_suffix_type::type_id:
+            return lookup<xcdat::trie_7_suffix_type>(p);
+        case xcdat::trie_8_suffix_type::type_id:
+            return lookup<xcdat::trie_8_suffix_type>(p);
+        case xcdat::trie_15_suffix_type::type_id:
+            return lookup<xcdat::trie_15_suffix_type>(p);
+        case xcdat::trie_16_suffix_type::type_id:
+            return lookup<xcdat::trie_16_suffix_type>(p);
+        case xcdat::trie_7_infix_type::type_id:
+            return lookup<xcdat::trie_7_infix_type>(p);
+        case xcdat::trie_8_infix_type::type_id:
+            return lookup<xcdat::trie_8_infix_type>(p);
+        case xcdat::trie_15_infix_type::type_id:
+            return lookup<xcdat::trie_15_infix_type>(p);
+        case xcdat::trie_16_infix_type::type_id:
+            return lookup<xcdat::trie_16_infix_type>(p);
+        case xcdat::trie_7_counting_type::type_id:
+            return lookup<xcdat::trie_7_counting_type>(p);
+        case xcdat::trie_8_counting_type::type_id:
+            return lookup<xcdat::trie_8_counting_type>(p);
+        case xcdat::trie_15_counting_type::type_id:
+            return lookup<xcdat::trie_15_counting_type>(p);
+        case xcdat::trie_16_counting_type::type_id:
+            return lookup<xcdat::trie_16_counting_type>(p);
+        case xcdat::louds_trie_type::type_id:
+            return lookup<xcdat::louds_trie_type>(p);
+        case xcdat::louds_trie_repair_type::type_id:
+            return lookup<xcdat::louds_trie_repair_type>(p);
+        case xcdat::louds_trie_nested_type::type_id:
+            return lookup<xcdat::louds_trie_nested_type>(p);
         default:
             break;
     }
@@ -8,13 +8,23 @@ cmd_line_parser::parser make_parser(int argc, char** argv) {
     cmd_line_parser::parser p(argc, argv);
     p.add("input_dic", "Input filepath of trie dictionary");
     p.add("max_num_results", "The max number of results (default=10)", "-n", false);
+    p.add("ids_only", "Are only the IDs of the results printed? (default=0)", "-i", false);
     return p;
 }
 
+// Whether the dictionary can emit only the IDs without reconstructing the keywords.
+template <class Trie, class = void>
+struct has_id_iterator : std::false_type {};
+
+template <class Trie>
+struct has_id_iterator<Trie, std::void_t<decltype(std::declval<const Trie&>().make_predictive_id_iterator(""))>>
+    : std::true_type {};
+
 template <class Trie>
 int predictive_search(const cmd_line_parser::parser& p) {
     const auto input_dic = p.get<std::string>("input_dic");
     const auto max_num_results = p.get<std::uint64_t>("max_num_results", 10);
+    const auto ids_only = p.get<bool>("ids_only", false);
 
     const mm::file_source<char> fin(input_dic.c_str(), mm::advice::sequential);
     const auto trie = xcdat::mmap<Trie>(fin.data());
@@ -24,17 +34,37 @@ int predictive_search(const cmd_line_parser::parser& p) {
         std::string str;
     };
     std::vector<result_type> results;
-    results.reserve(1ULL << 10);
+    std::vector<std::uint64_t> ids;
 
     for (std::string key; std::getline(std::cin, key);) {
-        results.clear();
-        trie.predictive_search(key, [&](std::uint64_t id, std::string_view str) {
-            results.push_back({id, std::string(str)});
-        });
+        if (ids_only) {
+            ids.clear();
+            if constexpr (has_id_iterator<Trie>::value) {
+                auto itr = trie.make_predictive_id_iterator(key);
+                while (ids.size() < max_num_results && itr.next()) {
+                    ids.push_back(itr.id());
+                }
+            } else {
+                auto itr = trie.make_predictive_iterator(key);
+                while (ids.size() < max_num_results && itr.next()) {
+                    ids.push_back(itr.id());
+                }
+            }
+            tfm::printfln("%d found", ids.size());
+            for (const std::uint64_t id : ids) {
+                tfm::printfln("%d", id);
+            }
+            continue;
+        }
 
+        // Only the first results are copied, since the search stops after the max number.
+        results.clear();
+        auto itr = trie.make_predictive_iterator(key);
+        while (results.size() < max_num_results && itr.next()) {
+            results.push_back({itr.id(), itr.decoded()});
+        }
         tfm::printfln("%d found", results.size());
-        for (std::uint64_t i = 0; i < std::min<std::uint64_t>(results.size(), max_num_results); i++) {
-            const auto& r = results[i];
+        for (const auto& r : results) {
             tfm::printfln("%d\t%s", r.id, r.str);
         }
     }
@@ -65,6 +95,100 @@ int main(int argc, char** argv) {
             return predictive_search<xcdat::trie_15_type>(p);
         case 16:
             return predictive_search<xcdat::trie_16_type>(p);
+        case xcdat::trie_7_repair_type::type_id:
+            return predictive_search<xcdat::trie_7_repair_type>(p);
+        case xcdat::trie_8_repair_type::type_id:
+            return predictive_search<xcdat::trie_8_repair_type>(p);
+        case xcdat::trie_15_repair_type::type_id:
+            return predictive_search<xcdat::trie_15_repair_type>(p);
+        case xcdat::trie_16_repair_type::type_id:
+            return predictive_search<xcdat::trie_16_repair_type>(p);
+        case xcdat::trie_7_nested_type::type_id:
+            return predictive_search<xcdat::trie_7_nested_type>(p);
+        case xcdat::trie_8_nested_type::type_id:
+            return predictive_search<xcdat::trie_8_nested_type>(p);
+        case xcdat::trie_15_nested_type::type_id:
+            return predictive_search<xcdat::trie_15_nested_type>(p);
+        case xcdat::trie_16_nested_type::type_id:
+            return predictive_search<xcdat::trie_16_nested_type>(p);
+        case xcdat::trie_7_utf8_type::type_id:
+            return predictive_search<xcdat::trie_7_utf8_type>(p);
+        case xcdat::trie_8_utf8_type::type_id:
+            return predictive_search<xcdat::trie_8_utf8_type>(p);
+        case xcdat::trie_15_utf8_type::type_id:
+            return predictive_search<xcdat::trie_15_utf8_type>(p);
+        case xcdat::trie_16_utf8_type::type_id:
+            return predictive_search<xcdat::trie_16_utf8_type>(p);
+        case xcdat::trie_7_encoded_type::type_id:
+            return predictive_search<xcdat::trie_7_encoded_type>(p);
+        case xcdat::trie_8_encoded_type::type_id:
+            return predictive_search<xcdat::trie_8_encoded_type>(p);
+        case xcdat::trie_15_encoded_type::type_id:
+            return predictive_search<xcdat::trie_15_encoded_type>(p);
+        case xcdat::trie_16_encoded_type::type_id:
+            return predictive_search<xcdat::trie_16_encoded_type>(p);
+        case xcdat::dawg_7_type::type_id:
+            return predictive_search<xcdat::dawg_7_type>(p);
+        case xcdat::dawg_8_type::type_id:
+            return predictive_search<xcdat::dawg_8_type>(p);
+        case xcdat::dawg_15_type::type_id:
+            return predictive_search<xcdat::dawg_15_type>(p);
+        case xcdat::dawg_16_type::type_id:
+            return predictive_search<xcdat::dawg_16_type>(p);
+        case xcdat::trie_7_lookup_type::type_id:
+            return predictive_search<xcdat::trie_7_lookup_type>(p);
+        case xcdat::trie_8_lookup_type::type_id:
+            return predictive_search<xcdat::trie_8_lookup_type>(p);
+        case xcdat::trie_15_lookup_type::type_id:
+            return predictive_search<xcdat::trie_15_lookup_type>(p);
+        case xcdat::trie_16_lookup_type::type_id:
+            return predictive_search<xcdat::trie_16_lookup_type>(p);
+        case xcdat::trie_7_fast_decode_type::type_id:
+            return predictive_search<xcdat::trie_7_fast_decode_type>(p);
+        case xcdat::trie_8_fast_decode_type::type_id:
+            return predictive_search<xcdat::trie_8_fast_decode_type>(p);
+        case xcdat::trie_15_fast_decode_type::type_id:
+            return predictive_search<xcdat::trie_15_fast_decode_type>(p);
+        case xcdat::trie_16_fast_decode_type::type_id:
+            return predictive_search<xcdat::trie_16_fast_decode_type>(p);
+        case xcdat::trie_7_fc_type::type_id:
+            return predictive_search<xcdat::trie_7_fc_type>(p);
+        case xcdat::trie_8_fc_type::type_id:
+            return predictive_search<xcdat::trie_8_fc_type>(p);
+        case xcdat::trie_15_fc_type::type_id:
+            return predictive_search<xcdat::trie_15_fc_type>(p);
+        case xcdat::trie_16_fc_type::type_id:
+            return predictive_search<xcdat::trie_16_fc_type>(p);
+        case xcdat::trie_7_suffix_type::type_id:
+            return predictive_search<xcdat::trie_7_suffix_type>(p);
+        case xcdat::trie_8_suffix_type::type_id:
+            return predictive_search<xcdat::trie_8_suffix_type>(p);
+        case xcdat::trie_15_suffix_type::type_id:
+            return predictive_search<xcdat::trie_15_suffix_type>(p);
+        case xcdat::trie_16_suffix_type::type_id:
+            return predictive_search<xcdat::trie_16_suffix_type>(p);
+        case xcdat::trie_7_infix_type::type_id:
+            return predictive_search<xcdat::trie_7_infix_type>(p);
+        case xcdat::trie_8_infix_type::type_id:
+            return predictive_search<xcdat::trie_8_infix_type>(p);
+        case xcdat::trie_15_infix_type::type_id:
+            return predictive_search<xcdat::trie_15_infix_type>(p);
+        case xcdat::trie_16_infix_type::type_id:
+            return predictive_search<xcdat::trie_16_infix_type>(p);
+        case xcdat::trie_7_counting_type::type_id:
+            return predictive_search<xcdat::trie_7_counting_type>(p);
+        case xcdat::trie_8_counting_type::type_id:
+            return predictive_search<xcdat::trie_8_counting_type>(p);
+        case xcdat::trie_15_counting_type::type_id:
+            return predictive_search<xcdat::trie_15_counting_type>(p);
+        case xcdat::trie_16_counting_type::type_id:
+            return predictive_search<xcdat::trie_16_counting_type>(p);
+        case xcdat::louds_trie_type::type_id:
+            return predictive_search<xcdat::louds_trie_type>(p);
+        case xcdat::louds_trie_repair_type::type_id:
+            return predictive_search<xcdat::louds_trie_repair_type>(p);
+        case xcdat::louds_trie_nested_type::type_id:
+            return predictive_search<xcdat::louds_trie_nested_type>(p);
         default:
             break;
     }
@@ -61,6 +61,100 @@ int main(int argc, char** argv) {
             return prefix_search<xcdat::trie_15_type>(p);
         case 16:
             return prefix_search<xcdat::trie_16_type>(p);
+        case xcdat::trie_7_repair_type::type_id:
+            return prefix_search<xcdat::trie_7_repair_type>(p);
+        case xcdat::trie_8_repair_type::type_id:
+            return prefix_search<xcdat::trie_8_repair_type>(p);
+        case xcdat::trie_15_repair_type::type_id:
+            return prefix_search<xcdat::trie_15_repair_type>(p);
+        case xcdat::trie_16_repair_type::type_id:
+            return prefix_search<xcdat::trie_16_repair_type>(p);
+        case xcdat::trie_7_nested_type::type_id:
+            return prefix_search<xcdat::trie_7_nested_type>(p);
+        case xcdat::trie_8_nested_type::type_id:
+            return prefix_search<xcdat::trie_8_nested_type>(p);
+        case xcdat::trie_15_nested_type::type_id:
+            return prefix_search<xcdat::trie_15_nested_type>(p);
+        case xcdat::trie_16_nested_type::type_id:
+            return prefix_search<xcdat::trie_16_nested_type>(p);
+        case xcdat::trie_7_utf8_type::type_id:
+            return prefix_search<xcdat::trie_7_utf8_type>(p);
+        case xcdat::trie_8_utf8_type::type_id:
+            return prefix_search<xcdat::trie_8_utf8_type>(p);
+        case xcdat::trie_15_utf8_type::type_id:
+            return prefix_search<xcdat::trie_15_utf8_type>(p);
+        case xcdat::trie_16_utf8_type::type_id:
+            return prefix_search<xcdat::trie_16_utf8_type>(p);
+        case xcdat::trie_7_encoded_type::type_id:
+            return prefix_search<xcdat::trie_7_encoded_type>(p);
+        case xcdat::trie_8_encoded_type::type_id:
+            return prefix_search<xcdat::trie_8_encoded_type>(p);
+        case xcdat::trie_15_encoded_type::type_id:
+            return prefix_search<xcdat::trie_15_encoded_type>(p);
+        case xcdat::trie_16_encoded_type::type_id:
+            return prefix_search<xcdat::trie_16_encoded_type>(p);
+        case xcdat::dawg_7_type::type_id:
+            return prefix_search<xcdat::dawg_7_type>(p);
+        case xcdat::dawg_8_type::type_id:
+            return prefix_search<xcdat::dawg_8_type>(p);
+        case xcdat::dawg_15_type::type_id:
+            return prefix_search<xcdat::dawg_15_type>(p);
+        case xcdat::dawg_16_type::type_id:
+            return prefix_search<xcdat::dawg_16_type>(p);
+        case xcdat::trie_7_lookup_type::type_id:
+            return prefix_search<xcdat::trie_7_lookup_type>(p);
+        case xcdat::trie_8_lookup_type::type_id:
+            return prefix_search<xcdat::trie_8_lookup_type>(p);
+        case xcdat::trie_15_lookup_type::type_id:
+            return prefix_search<xcdat::trie_15_lookup_type>(p);
+        case xcdat::trie_16_lookup_type::type_id:
+            return prefix_search<xcdat::trie_16_lookup_type>(p);
+        case xcdat::trie_7_fast_decode_type::type_id:
+            return prefix_search<xcdat::trie_7_fast_decode_type>(p);
+        case xcdat::trie_8_fast_decode_type::type_id:
+            return prefix_search<xcdat::trie_8_fast_decode_type>(p);
+        case xcdat::trie_15_fast_decode_type::type_id:
+            return prefix_search<xcdat::trie_15_fast_decode_type>(p);
+        case xcdat::trie_16_fast_decode_type::type_id:
+            return prefix_search<xcdat::trie_16_fast_decode_type>(p);
+        case xcdat::trie_7_fc_type::type_id:
+            return prefix_search<xcdat::trie_7_fc_type>(p);
+        case xcdat::trie_8_fc_type::type_id:
+            return prefix_search<xcdat::trie_8_fc_type>(p);
+        case xcdat::trie_15_fc_type::type_id:
+            return prefix_search<xcdat::trie_15_fc_type>(p);
+        case xcdat::trie_16_fc_type::type_id:
+            return prefix_search<xcdat::trie_16_fc_type>(p);
+        case xcdat::trie_7_suffix_type::type_id:
+            return prefix_search<xcdat::trie_7_suffix_type>(p);
+        case xcdat::trie_8_suffix_type::type_id:
+            return prefix_search<xcdat::trie_8_suffix_type>(p);
+        case xcdat::trie_15_suffix_type::type_id:
+            return prefix_search<xcdat::trie_15_suffix_type>(p);
+        case xcdat::trie_16_suffix_type::type_id:
+            return prefix_search<xcdat::trie_16_suffix_type>(p);
+        case xcdat::trie_7_infix_type::type_id:
+            return prefix_search<xcdat::trie_7_infix_type>(p);
+        case xcdat::trie_8_infix_type::type_id:
+            return prefix_search<xcdat::trie_8_infix_type>(p);
+        case xcdat::trie_15_infix_type::type_id:
+            return prefix_search<xcdat::trie_15_infix_type>(p);
+        case xcdat::trie_16_infix_type::type_id:
+            return prefix_search<xcdat::trie_16_infix_type>(p);
+        case xcdat::trie_7_counting_type::type_id:
+            return prefix_search<xcdat::trie_7_counting_type>(p);
+        case xcdat::trie_8_counting_type::type_id:
+            return prefix_search<xcdat::trie_8_counting_type>(p);
+        case xcdat::trie_15_counting_type::type_id:
+            return prefix_search<xcdat::trie_15_counting_type>(p);
+        case xcdat::trie_16_counting_type::type_id:
+            return prefix_search<xcdat::trie_16_counting_type>(p);
+        case xcdat::louds_trie_type::type_id:
+            return prefix_search<xcdat::louds_trie_type>(p);
+        case xcdat::louds_trie_repair_type::type_id:
+            return prefix_search<xcdat::louds_trie_repair_type>(p);
+        case xcdat::louds_trie_nested_type::type_id:
+            return prefix_search<xcdat::louds_trie_nested_type>(p);
         default:
             break;
     }